@@ -249,15 +249,10 @@ Json::Value Assembly::assemblyJSON(map<string, unsigned> const& _sourceIndices)
 	root[".code"] = Json::arrayValue;
 
 	Json::Value& collection = root[".code"];
+	SourceIndexResolver resolveSourceIndex{_sourceIndices};
 	for (AssemblyItem const& i: m_items)
 	{
-		int sourceIndex = -1;
-		if (i.location().sourceName)
-		{
-			auto iter = _sourceIndices.find(*i.location().sourceName);
-			if (iter != _sourceIndices.end())
-				sourceIndex = static_cast<int>(iter->second);
-		}
+		int sourceIndex = resolveSourceIndex(i.location());
 
 		switch (i.type())
 		{
@@ -434,15 +429,19 @@ map<u256, u256> const& Assembly::optimiseInternal(
 	// Run optimisation for sub-assemblies.
 	for (size_t subId = 0; subId < m_subs.size(); ++subId)
 	{
-		OptimiserSettings settings = _settings;
-		// Disable creation mode for sub-assemblies.
-		settings.isCreation = false;
-		map<u256, u256> const& subTagReplacements = m_subs[subId]->optimiseInternal(
-			settings,
-			JumpdestRemover::referencedTags(m_items, subId)
-		);
-		// Apply the replacements (can be empty).
-		BlockDeduplicator::applyTagReplacement(m_items, subTagReplacements, subId);
+		Assembly& sub = *m_subs[subId];
+		// Sub-assemblies are shared with the contracts they were compiled for and have usually been
+		// optimised already. In that case, there is no need to collect the tags referenced from here.
+		if (!sub.m_tagReplacements)
+		{
+			OptimiserSettings settings = _settings;
+			// Disable creation mode for sub-assemblies.
+			settings.isCreation = false;
+			sub.optimiseInternal(settings, JumpdestRemover::referencedTags(m_items, subId));
+		}
+		// Apply the replacements, unless they are empty.
+		if (!sub.m_tagReplacements->empty())
+			BlockDeduplicator::applyTagReplacement(m_items, *sub.m_tagReplacements, subId);
 	}
 
 	map<u256, u256> tagReplacements;
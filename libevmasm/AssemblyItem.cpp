@@ -26,6 +26,7 @@
 #include <libsolutil/FixedHash.h>
 #include <liblangutil/SourceLocation.h>
 
+#include <charconv>
 #include <fstream>
 #include <limits>
 
@@ -363,6 +364,17 @@ std::string AssemblyItem::computeSourceMapping(
 )
 {
 	string ret;
+	// Most entries consist of a few characters only.
+	ret.reserve(_items.size() * 4);
+	SourceIndexResolver sourceIndex{_sourceIndicesMap};
+
+	// Appends the decimal representation of @a _value without creating temporary strings.
+	auto appendNumber = [&ret](int _value) {
+		char buffer[16];
+		auto [end, error] = to_chars(begin(buffer), std::end(buffer), _value);
+		solAssert(error == errc{}, "");
+		ret.append(begin(buffer), end);
+	};
 
 	int prevStart = -1;
 	int prevLength = -1;
@@ -373,14 +385,11 @@ std::string AssemblyItem::computeSourceMapping(
 	for (auto const& item: _items)
 	{
 		if (!ret.empty())
-			ret += ";";
+			ret += ';';
 
 		SourceLocation const& location = item.location();
 		int length = location.start != -1 && location.end != -1 ? location.end - location.start : -1;
-		int sourceIndex =
-			(location.sourceName && _sourceIndicesMap.count(*location.sourceName)) ?
-			static_cast<int>(_sourceIndicesMap.at(*location.sourceName)) :
-			-1;
+		int itemSourceIndex = sourceIndex(location);
 		char jump = '-';
 		if (item.getJumpType() == evmasm::AssemblyItem::JumpType::IntoFunction)
 			jump = 'i';
@@ -395,7 +404,7 @@ std::string AssemblyItem::computeSourceMapping(
 			if (jump == prevJump)
 			{
 				components--;
-				if (sourceIndex == prevSourceIndex)
+				if (itemSourceIndex == prevSourceIndex)
 				{
 					components--;
 					if (length == prevLength)
@@ -411,17 +420,17 @@ std::string AssemblyItem::computeSourceMapping(
 		if (components-- > 0)
 		{
 			if (location.start != prevStart)
-				ret += to_string(location.start);
+				appendNumber(location.start);
 			if (components-- > 0)
 			{
 				ret += ':';
 				if (length != prevLength)
-					ret += to_string(length);
+					appendNumber(length);
 				if (components-- > 0)
 				{
 					ret += ':';
-					if (sourceIndex != prevSourceIndex)
-						ret += to_string(sourceIndex);
+					if (itemSourceIndex != prevSourceIndex)
+						appendNumber(itemSourceIndex);
 					if (components-- > 0)
 					{
 						ret += ':';
@@ -431,7 +440,7 @@ std::string AssemblyItem::computeSourceMapping(
 						{
 							ret += ':';
 							if (modifierDepth != prevModifierDepth)
-								ret += to_string(modifierDepth);
+								appendNumber(modifierDepth);
 						}
 					}
 				}
@@ -439,13 +448,26 @@ std::string AssemblyItem::computeSourceMapping(
 		}
 
 		if (item.opcodeCount() > 1)
-			ret += string(item.opcodeCount() - 1, ';');
+			ret.append(item.opcodeCount() - 1, ';');
 
 		prevStart = location.start;
 		prevLength = length;
-		prevSourceIndex = sourceIndex;
+		prevSourceIndex = itemSourceIndex;
 		prevJump = jump;
 		prevModifierDepth = modifierDepth;
 	}
 	return ret;
 }
+
+int SourceIndexResolver::operator()(SourceLocation const& _location)
+{
+	if (!_location.sourceName)
+		return -1;
+	if (_location.sourceName.get() != m_lastSourceName)
+	{
+		auto it = m_sourceIndices.find(*_location.sourceName);
+		m_lastSourceName = _location.sourceName.get();
+		m_lastSourceIndex = it == m_sourceIndices.end() ? -1 : static_cast<int>(it->second);
+	}
+	return m_lastSourceIndex;
+}
@@ -27,9 +27,11 @@
 #include <liblangutil/SourceLocation.h>
 #include <libsolutil/Common.h>
 #include <libsolutil/Assertions.h>
+#include <map>
 #include <optional>
 #include <iostream>
 #include <sstream>
+#include <string>
 
 namespace solidity::evmasm
 {
@@ -195,6 +197,27 @@ private:
 	mutable std::optional<size_t> m_immutableOccurrences;
 };
 
+/**
+ * Resolves the names of the sources referenced by source locations to their indices.
+ * Consecutive assembly items mostly refer to the same source name object, so the result of
+ * the last lookup is reused without comparing any strings.
+ */
+class SourceIndexResolver
+{
+public:
+	explicit SourceIndexResolver(std::map<std::string, unsigned> const& _sourceIndices):
+		m_sourceIndices(_sourceIndices)
+	{}
+
+	/// @returns the index of the source of @a _location or -1 if it is unknown.
+	int operator()(langutil::SourceLocation const& _location);
+
+private:
+	std::map<std::string, unsigned> const& m_sourceIndices;
+	std::string const* m_lastSourceName = nullptr;
+	int m_lastSourceIndex = -1;
+};
+
 inline size_t bytesRequired(AssemblyItems const& _items, size_t _addressLength,  Precision _precision = Precision::Precise)
 {
 	size_t size = 0;
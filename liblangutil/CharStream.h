@@ -79,6 +79,20 @@ public:
 
 	char get(size_t _charsForward = 0) const { return m_source[m_position + _charsForward]; }
 	char advanceAndGet(size_t _chars = 1);
+	/// Advances the position past all characters for which @a _predicate holds,
+	/// starting with the character at the current position.
+	/// @returns the character at the new position or 0 if the end of input has been reached.
+	template <typename Predicate>
+	char advanceWhile(Predicate const& _predicate)
+	{
+		size_t const size = m_source.size();
+		char const* data = m_source.data();
+		size_t position = m_position;
+		while (position < size && _predicate(data[position]))
+			++position;
+		m_position = position;
+		return position < size ? data[position] : 0;
+	}
 	/// Sets scanner position to @ _amount characters backwards in source text.
 	/// @returns The character of the current location after update is returned.
 	char rollback(size_t _amount);
@@ -14,35 +14,83 @@
 
 #pragma once
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
 namespace solidity::langutil
 {
 
+/// Bit flags describing the lexical classes of a character.
+enum CharClass: uint8_t
+{
+	CharClassDecimalDigit = 1 << 0,
+	CharClassHexLetter = 1 << 1,
+	CharClassWhiteSpace = 1 << 2,
+	CharClassIdentifierStart = 1 << 3,
+	/// Characters that can be skipped inside of a single-line comment without further checks,
+	/// i.e. everything except ASCII line terminators and the lead bytes of multi-byte
+	/// unicode line terminators.
+	CharClassCommentBody = 1 << 4
+};
+
+namespace detail
+{
+
+constexpr std::array<uint8_t, 256> makeCharClassTable()
+{
+	std::array<uint8_t, 256> table{};
+	for (size_t i = 0; i < table.size(); ++i)
+	{
+		char c = static_cast<char>(i);
+		uint8_t classes = 0;
+		if ('0' <= c && c <= '9')
+			classes |= CharClassDecimalDigit;
+		if (('a' <= c && c <= 'f') || ('A' <= c && c <= 'F'))
+			classes |= CharClassHexLetter;
+		if (c == ' ' || c == '\n' || c == '\t' || c == '\r')
+			classes |= CharClassWhiteSpace;
+		if (c == '_' || c == '$' || ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z'))
+			classes |= CharClassIdentifierStart;
+		if ((i < 0x0a || i > 0x0d) && i != 0xc2 && i != 0xe2)
+			classes |= CharClassCommentBody;
+		table[i] = classes;
+	}
+	return table;
+}
+
+inline constexpr std::array<uint8_t, 256> charClassTable = makeCharClassTable();
+
+}
+
+inline bool hasCharClass(char c, uint8_t _classes)
+{
+	return (detail::charClassTable[static_cast<uint8_t>(c)] & _classes) != 0;
+}
+
 inline bool isDecimalDigit(char c)
 {
-	return '0' <= c && c <= '9';
+	return hasCharClass(c, CharClassDecimalDigit);
 }
 
 inline bool isHexDigit(char c)
 {
-	return
-		isDecimalDigit(c) ||
-		('a' <= c && c <= 'f') ||
-		('A' <= c && c <= 'F');
+	return hasCharClass(c, CharClassDecimalDigit | CharClassHexLetter);
 }
 
 inline bool isWhiteSpace(char c)
 {
-	return c == ' ' || c == '\n' || c == '\t' || c == '\r';
+	return hasCharClass(c, CharClassWhiteSpace);
 }
 
 inline bool isIdentifierStart(char c)
 {
-	return c == '_' || c == '$' || ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z');
+	return hasCharClass(c, CharClassIdentifierStart);
 }
 
 inline bool isIdentifierPart(char c)
 {
-	return isIdentifierStart(c) || isDecimalDigit(c);
+	return hasCharClass(c, CharClassIdentifierStart | CharClassDecimalDigit);
 }
 
 inline int hexValue(char c)
@@ -247,20 +247,24 @@ Token Scanner::selectToken(char _next, Token _then, Token _else)
 
 bool Scanner::skipWhitespace()
 {
-	size_t const startPosition = sourcePos();
-	while (isWhiteSpace(m_char))
-		advance();
-	// Return whether or not we skipped any characters.
-	return sourcePos() != startPosition;
+	// m_char does not necessarily reflect the character at the current position
+	// (see skipMultiLineComment), so the first character is consumed separately.
+	if (!isWhiteSpace(m_char))
+		return false;
+	advance();
+	m_char = m_source.advanceWhile(isWhiteSpace);
+	return true;
 }
 
 bool Scanner::skipWhitespaceExceptUnicodeLinebreak()
 {
-	size_t const startPosition = sourcePos();
-	while (isWhiteSpace(m_char) && !isUnicodeLinebreak())
-		advance();
-	// Return whether or not we skipped any characters.
-	return sourcePos() != startPosition;
+	// The only unicode line breaks among the whitespace characters are '\n' and '\r'.
+	auto const isBlank = [](char _c) { return _c == ' ' || _c == '\t'; };
+	if (!isBlank(m_char))
+		return false;
+	advance();
+	m_char = m_source.advanceWhile(isBlank);
+	return true;
 }
 
 
@@ -283,6 +287,12 @@ static ScannerError validateBiDiMarkup(CharStream& _stream, size_t _startPositio
 	};
 
 	size_t endPosition = _stream.position();
+
+	// All directional sequences start with the same byte, avoid the character-wise
+	// check if it does not occur at all.
+	if (_stream.source().find('\xE2', _startPosition) >= endPosition)
+		return ScannerError::NoError;
+
 	_stream.setPosition(_startPosition);
 
 	int directionOverrideDepth = 0;
@@ -312,8 +322,11 @@ Token Scanner::skipSingleLineComment()
 	// non-ascii line terminator, it will result in a parser error.
 	size_t startPosition = m_source.position();
 	while (!isUnicodeLinebreak())
+	{
 		if (!advance())
 			break;
+		m_char = m_source.advanceWhile([](char _c) { return hasCharClass(_c, CharClassCommentBody); });
+	}
 
 	ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
 	if (unicodeDirectionError != ScannerError::NoError)
@@ -391,26 +404,24 @@ size_t Scanner::scanSingleLineDocComment()
 Token Scanner::skipMultiLineComment()
 {
 	size_t startPosition = m_source.position();
-	while (!isSourcePastEndOfInput())
+	size_t terminatorPosition = m_source.source().find("*/", startPosition);
+	if (terminatorPosition == string::npos)
 	{
-		char prevChar = m_char;
-		advance();
+		// Unterminated multi-line comment.
+		m_char = m_source.setPosition(m_source.size());
+		return setError(ScannerError::IllegalCommentTerminator);
+	}
 
-		// If we have reached the end of the multi-line comment, we
-		// consume the '/' and insert a whitespace. This way all
-		// multi-line comments are treated as whitespace.
-		if (prevChar == '*' && m_char == '/')
-		{
-			ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
-			if (unicodeDirectionError != ScannerError::NoError)
-				return setError(unicodeDirectionError);
+	// We have reached the end of the multi-line comment, we
+	// consume the '/' and insert a whitespace. This way all
+	// multi-line comments are treated as whitespace.
+	m_char = m_source.setPosition(terminatorPosition + 1);
+	ScannerError unicodeDirectionError = validateBiDiMarkup(m_source, startPosition);
+	if (unicodeDirectionError != ScannerError::NoError)
+		return setError(unicodeDirectionError);
 
-			m_char = ' ';
-			return Token::Whitespace;
-		}
-	}
-	// Unterminated multi-line comment.
-	return setError(ScannerError::IllegalCommentTerminator);
+	m_char = ' ';
+	return Token::Whitespace;
 }
 
 Token Scanner::scanMultiLineDocComment()
@@ -905,9 +916,9 @@ void Scanner::scanDecimalDigits()
 		return;
 
 	// May continue with decimal digit or underscore for grouping.
-	do
-		addLiteralCharAndAdvance();
-	while (!m_source.isPastEndOfInput() && (isDecimalDigit(m_char) || m_char == '_'));
+	size_t const startPosition = m_source.position();
+	m_char = m_source.advanceWhile([](char _c) { return isDecimalDigit(_c) || _c == '_'; });
+	m_tokens[NextNext].literal.append(m_source.source(), startPosition, m_source.position() - startPosition);
 
 	// Defer further validation of underscore to SyntaxChecker.
 }
@@ -1010,10 +1021,13 @@ tuple<Token, unsigned, unsigned> Scanner::scanIdentifierOrKeyword()
 {
 	solAssert(isIdentifierStart(m_char), "");
 	LiteralScope literal(this, LITERAL_TYPE_STRING);
-	addLiteralCharAndAdvance();
+	size_t const startPosition = m_source.position();
 	// Scan the rest of the identifier characters.
-	while (isIdentifierPart(m_char) || (m_char == '.' && m_kind == ScannerKind::Yul))
-		addLiteralCharAndAdvance();
+	if (m_kind == ScannerKind::Yul)
+		m_char = m_source.advanceWhile([](char _c) { return isIdentifierPart(_c) || _c == '.'; });
+	else
+		m_char = m_source.advanceWhile(isIdentifierPart);
+	m_tokens[NextNext].literal.assign(m_source.source(), startPosition, m_source.position() - startPosition);
 	literal.complete();
 	auto const token = TokenTraits::fromIdentifierOrKeyword(m_tokens[NextNext].literal);
 	if (m_kind == ScannerKind::Yul)
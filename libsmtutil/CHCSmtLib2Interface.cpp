@@ -100,11 +100,12 @@ tuple<CheckResult, Expression, CHCSolverInterface::CexGraph> CHCSmtLib2Interface
 	string queryRule = "(assert\n(forall " + forall() + "\n" +
 		"(=> " + _block.name + " false)"
 		"))";
-	string response = querySolver(
+	string query =
 		m_accumulatedOutput +
 		queryRule +
-		"\n(check-sat)"
-	);
+		"\n(check-sat)";
+	m_lastQuerySize = query.size();
+	string response = querySolver(query);
 	swap(m_accumulatedOutput, accumulated);
 
 	CheckResult result;
@@ -48,6 +48,10 @@ public:
 	/// @returns solving result, an invariant, and counterexample graph, if possible.
 	std::tuple<CheckResult, Expression, CexGraph> query(Expression const& _expr) override;
 
+	std::string solverName() const override { return "smtlib2"; }
+
+	std::optional<size_t> lastQuerySize() override { return m_lastQuerySize; }
+
 	void declareVariable(std::string const& _name, SortPointer const& _sort) override;
 
 	std::vector<std::string> unhandledQueries() const { return m_unhandledQueries; }
@@ -72,6 +76,7 @@ private:
 	std::unique_ptr<SMTLib2Interface> m_smtlib2;
 
 	std::string m_accumulatedOutput;
+	std::optional<size_t> m_lastQuerySize;
 	std::set<std::string> m_variables;
 
 	std::map<util::h256, std::string> const& m_queryResponses;
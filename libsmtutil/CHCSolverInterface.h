@@ -59,6 +59,13 @@ public:
 		Expression const& _expr
 	) = 0;
 
+	/// @returns the name of the solver, as used in the model checker settings.
+	virtual std::string solverName() const = 0;
+
+	/// @returns the size in bytes of the last query sent by ``query`` in SMT-LIB2 format,
+	/// or nullopt if the solver cannot provide it.
+	virtual std::optional<size_t> lastQuerySize() { return {}; }
+
 protected:
 	std::optional<unsigned> m_queryTimeout;
 };
@@ -116,10 +116,11 @@ void SMTLib2Interface::addAssertion(Expression const& _expr)
 
 pair<CheckResult, vector<string>> SMTLib2Interface::check(vector<Expression> const& _expressionsToEvaluate)
 {
-	string response = querySolver(
+	string query =
 		boost::algorithm::join(m_accumulatedOutput, "\n") +
-		checkSatAndGetValuesCommand(_expressionsToEvaluate)
-	);
+		checkSatAndGetValuesCommand(_expressionsToEvaluate);
+	m_lastQuerySize = query.size();
+	string response = querySolver(query);
 
 	CheckResult result;
 	// TODO proper parsing
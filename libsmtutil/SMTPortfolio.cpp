@@ -41,14 +41,23 @@ SMTPortfolio::SMTPortfolio(
 	SolverInterface(_queryTimeout)
 {
 	if (_enabledSolvers.smtlib2)
+	{
 		m_solvers.emplace_back(make_unique<SMTLib2Interface>(move(_smtlib2Responses), move(_smtCallback), m_queryTimeout));
+		m_solverNames.emplace_back("smtlib2");
+	}
 #ifdef HAVE_Z3
 	if (_enabledSolvers.z3 && Z3Interface::available())
+	{
 		m_solvers.emplace_back(make_unique<Z3Interface>(m_queryTimeout));
+		m_solverNames.emplace_back("z3");
+	}
 #endif
 #ifdef HAVE_CVC4
 	if (_enabledSolvers.cvc4)
+	{
 		m_solvers.emplace_back(make_unique<CVC4Interface>(m_queryTimeout));
+		m_solverNames.emplace_back("cvc4");
+	}
 #endif
 }
 
@@ -117,21 +126,24 @@ pair<CheckResult, vector<string>> SMTPortfolio::check(vector<Expression> const&
 {
 	CheckResult lastResult = CheckResult::ERROR;
 	vector<string> finalValues;
-	for (auto const& s: m_solvers)
+	m_answeringSolver.reset();
+	for (size_t i = 0; i < m_solvers.size(); ++i)
 	{
 		CheckResult result;
 		vector<string> values;
-		tie(result, values) = s->check(_expressionsToEvaluate);
+		tie(result, values) = m_solvers[i]->check(_expressionsToEvaluate);
 		if (solverAnswered(result))
 		{
 			if (!solverAnswered(lastResult))
 			{
 				lastResult = result;
 				finalValues = std::move(values);
+				m_answeringSolver = i;
 			}
 			else if (lastResult != result)
 			{
 				lastResult = CheckResult::CONFLICTING;
+				m_answeringSolver.reset();
 				break;
 			}
 		}
@@ -151,6 +163,24 @@ vector<string> SMTPortfolio::unhandledQueries()
 	return {};
 }
 
+optional<size_t> SMTPortfolio::lastQuerySize()
+{
+	if (m_answeringSolver)
+		if (auto size = m_solvers.at(*m_answeringSolver)->lastQuerySize())
+			return size;
+	for (auto const& s: m_solvers)
+		if (auto size = s->lastQuerySize())
+			return size;
+	return {};
+}
+
+optional<string> SMTPortfolio::answeringSolver() const
+{
+	if (m_answeringSolver)
+		return m_solverNames.at(*m_answeringSolver);
+	return {};
+}
+
 bool SMTPortfolio::solverAnswered(CheckResult result)
 {
 	return result == CheckResult::SATISFIABLE || result == CheckResult::UNSATISFIABLE;
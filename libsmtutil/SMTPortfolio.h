@@ -24,6 +24,8 @@
 #include <libsolutil/FixedHash.h>
 
 #include <map>
+#include <optional>
+#include <string>
 #include <vector>
 
 namespace solidity::smtutil
@@ -62,10 +64,19 @@ public:
 
 	std::vector<std::string> unhandledQueries() override;
 	size_t solvers() override { return m_solvers.size(); }
+	/// @returns the size of the last query sent to the solver that answered it or, if no solver answered,
+	/// the size reported by the first solver able to provide it.
+	std::optional<size_t> lastQuerySize() override;
+	/// @returns the name of the solver whose answer was the result of the last query,
+	/// or nullopt if no solver answered or the answers were conflicting.
+	std::optional<std::string> answeringSolver() const;
 private:
 	static bool solverAnswered(CheckResult result);
 
 	std::vector<std::unique_ptr<SolverInterface>> m_solvers;
+	std::vector<std::string> m_solverNames;
+	/// Index of the solver whose answer was the result of the last query.
+	std::optional<size_t> m_answeringSolver;
 
 	std::vector<Expression> m_assertions;
 };
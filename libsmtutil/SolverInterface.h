@@ -537,6 +537,10 @@ public:
 	/// @returns how many SMT solvers this interface has.
 	virtual size_t solvers() { return 1; }
 
+	/// @returns the size in bytes of the last query sent by ``check`` in SMT-LIB2 format,
+	/// or nullopt if the solver cannot provide it.
+	virtual std::optional<size_t> lastQuerySize() { return {}; }
+
 protected:
 	std::optional<unsigned> m_queryTimeout;
 };
@@ -45,6 +45,11 @@ public:
 
 	std::tuple<CheckResult, Expression, CexGraph> query(Expression const& _expr) override;
 
+	std::string solverName() const override { return "z3"; }
+
+	/// The size of the Horn system the last query ran on, which ``query`` does not change.
+	std::optional<size_t> lastQuerySize() override { return m_solver.to_string().size(); }
+
 	Z3Interface* z3Interface() const { return m_z3Interface.get(); }
 
 	void setSpacerOptions(bool _preProcessing = true);
@@ -45,6 +45,9 @@ public:
 	void addAssertion(Expression const& _expr) override;
 	std::pair<CheckResult, std::vector<std::string>> check(std::vector<Expression> const& _expressionsToEvaluate) override;
 
+	/// The assertions are still those of the last query, since ``check`` does not change them.
+	std::optional<size_t> lastQuerySize() override { return m_solver.to_smt2().size(); }
+
 	z3::expr toZ3Expr(Expression const& _expr);
 	smtutil::Expression fromZ3Expr(z3::expr const& _expr);
 
@@ -193,6 +193,15 @@ void TypeProvider::reset()
 
 	instance().m_generalTypes.clear();
 	instance().m_stringLiteralTypes.clear();
+	instance().m_byteArrayTypes.clear();
+	instance().m_dynamicArrayTypes.clear();
+	instance().m_staticArrayTypes.clear();
+	instance().m_arraySliceTypes.clear();
+	instance().m_mappingTypes.clear();
+	instance().m_tupleTypes.clear();
+	instance().m_locationTypes.clear();
+	instance().m_typeTypes.clear();
+	instance().m_enumTypes.clear();
 	instance().m_ufixedMxN.clear();
 	instance().m_fixedMxN.clear();
 }
@@ -204,6 +213,15 @@ inline T const* TypeProvider::createAndGet(Args&& ... _args)
 	return static_cast<T const*>(instance().m_generalTypes.back().get());
 }
 
+template <typename T, typename Key, typename... Args>
+inline T const* TypeProvider::createAndGetInterned(map<Key, unique_ptr<T>>& _types, Key _key, Args&& ... _args)
+{
+	auto&& [it, inserted] = _types.try_emplace(move(_key));
+	if (inserted)
+		it->second = make_unique<T>(std::forward<Args>(_args)...);
+	return it->second.get();
+}
+
 Type const* TypeProvider::fromElementaryTypeName(ElementaryTypeNameToken const& _type, std::optional<StateMutability> _stateMutability)
 {
 	solAssert(
@@ -404,7 +422,7 @@ TupleType const* TypeProvider::tuple(vector<Type const*> members)
 	if (members.empty())
 		return &m_emptyTuple;
 
-	return createAndGet<TupleType>(move(members));
+	return createAndGetInterned(instance().m_tupleTypes, members, members);
 }
 
 ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, DataLocation _location, bool _isPointer)
@@ -412,8 +430,17 @@ ReferenceType const* TypeProvider::withLocation(ReferenceType const* _type, Data
 	if (_type->location() == _location && _type->isPointer() == _isPointer)
 		return _type;
 
-	instance().m_generalTypes.emplace_back(_type->copyForLocation(_location, _isPointer));
-	return static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	// Struct types cache their members, see structType().
+	if (_type->category() == Type::Category::Struct)
+	{
+		instance().m_generalTypes.emplace_back(_type->copyForLocation(_location, _isPointer));
+		return static_cast<ReferenceType const*>(instance().m_generalTypes.back().get());
+	}
+
+	auto&& [it, inserted] = instance().m_locationTypes.try_emplace({_type, _location, _isPointer});
+	if (inserted)
+		it->second = _type->copyForLocation(_location, _isPointer);
+	return it->second.get();
 }
 
 FunctionType const* TypeProvider::function(FunctionDefinition const& _function, FunctionType::Kind _kind)
@@ -507,32 +534,40 @@ ArrayType const* TypeProvider::array(DataLocation _location, bool _isString)
 		if (_location == DataLocation::Memory)
 			return bytesMemory();
 	}
-	return createAndGet<ArrayType>(_location, _isString);
+	return createAndGetInterned(instance().m_byteArrayTypes, make_pair(_location, _isString), _location, _isString);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType)
 {
-	return createAndGet<ArrayType>(_location, _baseType);
+	return createAndGetInterned(instance().m_dynamicArrayTypes, make_pair(_location, _baseType), _location, _baseType);
 }
 
 ArrayType const* TypeProvider::array(DataLocation _location, Type const* _baseType, u256 const& _length)
 {
-	return createAndGet<ArrayType>(_location, _baseType, _length);
+	return createAndGetInterned(
+		instance().m_staticArrayTypes,
+		make_tuple(_location, _baseType, _length),
+		_location,
+		_baseType,
+		_length
+	);
 }
 
 ArraySliceType const* TypeProvider::arraySlice(ArrayType const& _arrayType)
 {
-	return createAndGet<ArraySliceType>(_arrayType);
+	return createAndGetInterned(instance().m_arraySliceTypes, &_arrayType, _arrayType);
 }
 
 ContractType const* TypeProvider::contract(ContractDefinition const& _contractDef, bool _isSuper)
 {
+	// Not interned for the same reason as struct types: The cached members, interface types
+	// and constructor type are derived from annotations that can still change.
 	return createAndGet<ContractType>(_contractDef, _isSuper);
 }
 
 EnumType const* TypeProvider::enumType(EnumDefinition const& _enumDef)
 {
-	return createAndGet<EnumType>(_enumDef);
+	return createAndGetInterned(instance().m_enumTypes, &_enumDef, _enumDef);
 }
 
 ModuleType const* TypeProvider::module(SourceUnit const& _source)
@@ -542,11 +577,14 @@ ModuleType const* TypeProvider::module(SourceUnit const& _source)
 
 TypeType const* TypeProvider::typeType(Type const* _actualType)
 {
-	return createAndGet<TypeType>(_actualType);
+	return createAndGetInterned(instance().m_typeTypes, _actualType, _actualType);
 }
 
 StructType const* TypeProvider::structType(StructDefinition const& _struct, DataLocation _location)
 {
+	// Not interned: The type caches its members and interface types, which are derived from the
+	// annotations of the struct members. These annotations are filled in while struct types are
+	// already in use, so a shared object could keep results computed from incomplete annotations.
 	return createAndGet<StructType>(_struct, _location);
 }
 
@@ -576,7 +614,7 @@ MagicType const* TypeProvider::meta(Type const* _type)
 
 MappingType const* TypeProvider::mapping(Type const* _keyType, Type const* _valueType)
 {
-	return createAndGet<MappingType>(_keyType, _valueType);
+	return createAndGetInterned(instance().m_mappingTypes, make_pair(_keyType, _valueType), _keyType, _valueType);
 }
 
 UserDefinedValueType const* TypeProvider::userDefinedValueType(UserDefinedValueTypeDefinition const& _definition)
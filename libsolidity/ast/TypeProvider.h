@@ -24,7 +24,9 @@
 #include <map>
 #include <memory>
 #include <optional>
+#include <tuple>
 #include <utility>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -214,6 +216,12 @@ private:
 	template <typename T, typename... Args>
 	static inline T const* createAndGet(Args&& ... _args);
 
+	/// @returns the type stored in @a _types under @a _key. If there is none, it is created from @a _args first.
+	/// Used for types that are fully determined by their constructor arguments, so that structurally
+	/// identical types are represented by the same object.
+	template <typename T, typename Key, typename... Args>
+	static inline T const* createAndGetInterned(std::map<Key, std::unique_ptr<T>>& _types, Key _key, Args&& ... _args);
+
 	static BoolType const m_boolean;
 	static InaccessibleDynamicType const m_inaccessibleDynamic;
 
@@ -235,6 +243,16 @@ private:
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_ufixedMxN{};
 	std::map<std::pair<unsigned, unsigned>, std::unique_ptr<FixedPointType>> m_fixedMxN{};
 	std::map<std::string, std::unique_ptr<StringLiteralType>> m_stringLiteralTypes{};
+	/// Interned composite types, see createAndGetInterned.
+	std::map<std::pair<DataLocation, bool>, std::unique_ptr<ArrayType>> m_byteArrayTypes{};
+	std::map<std::pair<DataLocation, Type const*>, std::unique_ptr<ArrayType>> m_dynamicArrayTypes{};
+	std::map<std::tuple<DataLocation, Type const*, u256>, std::unique_ptr<ArrayType>> m_staticArrayTypes{};
+	std::map<ArrayType const*, std::unique_ptr<ArraySliceType>> m_arraySliceTypes{};
+	std::map<std::pair<Type const*, Type const*>, std::unique_ptr<MappingType>> m_mappingTypes{};
+	std::map<std::vector<Type const*>, std::unique_ptr<TupleType>> m_tupleTypes{};
+	std::map<std::tuple<ReferenceType const*, DataLocation, bool>, std::unique_ptr<ReferenceType>> m_locationTypes{};
+	std::map<Type const*, std::unique_ptr<TypeType>> m_typeTypes{};
+	std::map<EnumDefinition const*, std::unique_ptr<EnumType>> m_enumTypes{};
 	std::vector<std::unique_ptr<Type>> m_generalTypes{};
 };
 
@@ -35,6 +35,40 @@ using namespace solidity;
 using namespace solidity::util;
 using namespace solidity::frontend;
 
+namespace
+{
+
+/// @returns true if the ABI routines for @a _type do not depend on any declaration in the
+/// source code, i.e. if the type neither is nor contains a struct, enum, contract, function
+/// or user-defined value type.
+bool astIndependent(Type const& _type)
+{
+	switch (_type.category())
+	{
+	case Type::Category::Address:
+	case Type::Category::Integer:
+	case Type::Category::RationalNumber:
+	case Type::Category::StringLiteral:
+	case Type::Category::Bool:
+	case Type::Category::FixedPoint:
+	case Type::Category::FixedBytes:
+		return true;
+	case Type::Category::Array:
+		return astIndependent(*dynamic_cast<ArrayType const&>(_type).baseType());
+	case Type::Category::ArraySlice:
+		return astIndependent(dynamic_cast<ArraySliceType const&>(_type).arrayType());
+	default:
+		return false;
+	}
+}
+
+bool astIndependent(TypePointers const& _types)
+{
+	return all_of(_types.begin(), _types.end(), [](Type const* _type) { return astIndependent(*_type); });
+}
+
+}
+
 string ABIFunctions::tupleEncoder(
 	TypePointers const& _givenTypes,
 	TypePointers _targetTypes,
@@ -113,7 +147,7 @@ string ABIFunctions::tupleEncoder(
 		templ("encodeElements", encodeElements);
 
 		return templ.render();
-	});
+	}, astIndependent(_givenTypes) && astIndependent(_targetTypes));
 }
 
 string ABIFunctions::tupleEncoderPacked(
@@ -188,7 +222,7 @@ string ABIFunctions::tupleEncoderPacked(
 		templ("encodeElements", encodeElements);
 
 		return templ.render();
-	});
+	}, astIndependent(_givenTypes) && astIndependent(_targetTypes));
 }
 string ABIFunctions::tupleDecoder(TypePointers const& _types, bool _fromMemory)
 {
@@ -257,7 +291,7 @@ string ABIFunctions::tupleDecoder(TypePointers const& _types, bool _fromMemory)
 		templ("decodeElements", decodeElements);
 
 		return templ.render();
-	});
+	}, astIndependent(_types));
 }
 
 string ABIFunctions::EncodingOptions::toFunctionNameSuffix() const
@@ -1533,9 +1567,13 @@ string ABIFunctions::arrayStoreLengthForEncodingFunction(ArrayType const& _type,
 	});
 }
 
-string ABIFunctions::createFunction(string const& _name, function<string ()> const& _creator)
+string ABIFunctions::createFunction(
+	string const& _name,
+	function<string ()> const& _creator,
+	bool _astIndependent
+)
 {
-	return m_functionCollector.createFunction(_name, _creator);
+	return m_functionCollector.createSharedFunction(_name, _creator, _astIndependent);
 }
 
 size_t ABIFunctions::headSize(TypePointers const& _targetTypes)
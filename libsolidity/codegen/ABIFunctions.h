@@ -261,8 +261,14 @@ private:
 
 	/// Helper function that uses @a _creator to create a function and add it to
 	/// @a m_requestedFunctions if it has not been created yet and returns @a _name in both
-	/// cases.
-	std::string createFunction(std::string const& _name, std::function<std::string()> const& _creator);
+	/// cases. The function is shared with other contracts via the function collector's cache.
+	/// If @a _astIndependent is true, it is also shared with other compilations, see
+	/// MultiUseYulFunctionCollector::createSharedFunction.
+	std::string createFunction(
+		std::string const& _name,
+		std::function<std::string()> const& _creator,
+		bool _astIndependent = false
+	);
 
 	/// @returns the size of the static part of the encoding of the given types.
 	static size_t headSize(TypePointers const& _targetTypes);
@@ -37,19 +37,38 @@ namespace solidity::frontend
 class Compiler
 {
 public:
-	Compiler(langutil::EVMVersion _evmVersion, RevertStrings _revertStrings, OptimiserSettings _optimiserSettings):
+	/// @a _astIndependentFunctionCache can be null, see MultiUseYulFunctionCollector.
+	Compiler(
+		langutil::EVMVersion _evmVersion,
+		RevertStrings _revertStrings,
+		OptimiserSettings _optimiserSettings,
+		std::shared_ptr<MultiUseYulFunctionCache> const& _astIndependentFunctionCache = nullptr
+	):
 		m_optimiserSettings(std::move(_optimiserSettings)),
-		m_runtimeContext(_evmVersion, _revertStrings),
-		m_context(_evmVersion, _revertStrings, &m_runtimeContext)
+		m_runtimeContext(_evmVersion, _revertStrings, nullptr, _astIndependentFunctionCache),
+		m_context(_evmVersion, _revertStrings, &m_runtimeContext, _astIndependentFunctionCache)
 	{ }
 
-	/// Compiles a contract.
+	/// Compiles a contract and optimises the resulting assembly.
 	/// @arg _metadata contains the to be injected metadata CBOR
 	void compileContract(
 		ContractDefinition const& _contract,
 		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> const& _otherCompilers,
 		bytes const& _metadata
+	)
+	{
+		generateCode(_contract, _otherCompilers, _metadata);
+		optimise();
+	}
+	/// Generates the unoptimised assembly of a contract.
+	/// @arg _metadata contains the to be injected metadata CBOR
+	void generateCode(
+		ContractDefinition const& _contract,
+		std::map<ContractDefinition const*, std::shared_ptr<Compiler const>> const& _otherCompilers,
+		bytes const& _metadata
 	);
+	/// Runs the optimiser on the assembly generated by @a generateCode.
+	void optimise();
 	/// @returns Entire assembly.
 	evmasm::Assembly const& assembly() const { return m_context.assembly(); }
 	/// @returns Runtime assembly.
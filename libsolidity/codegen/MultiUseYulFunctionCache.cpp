@@ -0,0 +1,65 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache of generated Yul utility functions, shared within a compilation or within the process.
+ */
+
+#include <libsolidity/codegen/MultiUseYulFunctionCache.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::frontend;
+
+shared_ptr<MultiUseYulFunctionCache::Function const> MultiUseYulFunctionCache::find(Key const& _key)
+{
+	lock_guard<mutex> lock(m_mutex);
+	auto it = m_functions.find(_key);
+	if (it == m_functions.end())
+		return nullptr;
+	m_recentlyUsed.splice(m_recentlyUsed.begin(), m_recentlyUsed, it->second.recentlyUsed);
+	++m_hits;
+	return it->second.function;
+}
+
+void MultiUseYulFunctionCache::store(Key _key, Function _function)
+{
+	auto function = make_shared<Function const>(move(_function));
+	lock_guard<mutex> lock(m_mutex);
+	if (m_maxSize == 0 || m_functions.count(_key))
+		return;
+	if (m_functions.size() == m_maxSize)
+	{
+		m_functions.erase(m_recentlyUsed.back());
+		m_recentlyUsed.pop_back();
+	}
+	m_recentlyUsed.push_front(_key);
+	m_functions.emplace(move(_key), Entry{move(function), m_recentlyUsed.begin()});
+}
+
+size_t MultiUseYulFunctionCache::hits() const
+{
+	lock_guard<mutex> lock(m_mutex);
+	return m_hits;
+}
+
+shared_ptr<MultiUseYulFunctionCache> const& MultiUseYulFunctionCache::processWide()
+{
+	// Limits the memory used by long-running processes compiling many different projects.
+	static shared_ptr<MultiUseYulFunctionCache> const cache = make_shared<MultiUseYulFunctionCache>(20000);
+	return cache;
+}
@@ -0,0 +1,97 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache of generated Yul utility functions, shared within a compilation or within the process.
+ */
+
+#pragma once
+
+#include <libsolidity/interface/DebugSettings.h>
+
+#include <liblangutil/EVMVersion.h>
+
+#include <limits>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace solidity::frontend
+{
+
+/**
+ * Stores the code of Yul utility functions (as generated by YulUtilFunctions and ABIFunctions)
+ * so that they are only generated once per compilation, even though every contract needs its
+ * own copy. Functions are identified by their name and the settings that influence their code.
+ *
+ * The cache can be shared between threads. Since function names contain AST IDs, it must not
+ * outlive the compilation it was created for, unless it only holds functions that do not depend
+ * on the AST at all, like the process-wide cache.
+ */
+class MultiUseYulFunctionCache
+{
+public:
+	struct Function
+	{
+		/// The code of the function itself.
+		std::string code;
+		/// All functions requested while generating the function, by name, in the order of the
+		/// requests. They stay available even if the cache evicts them.
+		std::vector<std::pair<std::string, std::shared_ptr<Function const>>> dependencies;
+	};
+	using Key = std::tuple<langutil::EVMVersion, RevertStrings, std::string>;
+
+	/// Creates a cache that holds at most @a _maxSize functions. If it is full, storing a function
+	/// evicts the least recently used one.
+	explicit MultiUseYulFunctionCache(size_t _maxSize = std::numeric_limits<size_t>::max()):
+		m_maxSize(_maxSize)
+	{}
+
+	/// @returns the cache shared by all compilations in this process. It must only be used for
+	/// functions that do not depend on the AST, i.e. on any declaration in the source code.
+	static std::shared_ptr<MultiUseYulFunctionCache> const& processWide();
+
+	/// @returns the function stored under @a _key or nullptr if there is none.
+	std::shared_ptr<Function const> find(Key const& _key);
+	/// Stores @a _function under @a _key unless there already is a function with that key.
+	void store(Key _key, Function _function);
+
+	/// @returns the number of calls to @a find that found a function.
+	size_t hits() const;
+
+private:
+	struct Entry
+	{
+		std::shared_ptr<Function const> function;
+		/// Position of the key in @a m_recentlyUsed.
+		std::list<Key>::iterator recentlyUsed;
+	};
+
+	size_t const m_maxSize;
+	mutable std::mutex m_mutex;
+	std::map<Key, Entry> m_functions;
+	/// Keys of all stored functions, the most recently used one first.
+	std::list<Key> m_recentlyUsed;
+	size_t m_hits = 0;
+};
+
+}
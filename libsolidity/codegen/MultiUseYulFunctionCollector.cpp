@@ -25,48 +25,32 @@
 #include <liblangutil/Exceptions.h>
 #include <libsolutil/Whiskers.h>
 #include <libsolutil/StringUtils.h>
+#include <libsolutil/Common.h>
+
+#include <algorithm>
 
 using namespace std;
 using namespace solidity;
 using namespace solidity::frontend;
 using namespace solidity::util;
 
-string MultiUseYulFunctionCollector::requestedFunctions()
-{
-	string result = move(m_code);
-	m_code.clear();
-	m_requestedFunctions.clear();
-	return result;
-}
-
-string MultiUseYulFunctionCollector::createFunction(string const& _name, function<string ()> const& _creator)
+namespace
 {
-	if (!m_requestedFunctions.count(_name))
-	{
-		m_requestedFunctions.insert(_name);
-		string fun = _creator();
-		solAssert(!fun.empty(), "");
-		solAssert(fun.find("function " + _name + "(") != string::npos, "Function not properly named.");
-		m_code += move(fun);
-	}
-	return _name;
-}
 
-string MultiUseYulFunctionCollector::createFunction(
+/// @returns a creator that assembles the function named @a _name from the body, parameters
+/// and return parameters provided by @a _creator.
+function<string()> wrapFunctionBody(
 	string const& _name,
 	function<string(vector<string>&, vector<string>&)> const& _creator
 )
 {
-	solAssert(!_name.empty(), "");
-	if (!m_requestedFunctions.count(_name))
-	{
-		m_requestedFunctions.insert(_name);
+	return [&]() {
 		vector<string> arguments;
 		vector<string> returnParameters;
 		string body = _creator(arguments, returnParameters);
 		solAssert(!body.empty(), "");
 
-		m_code += Whiskers(R"(
+		return Whiskers(R"(
 			function <functionName>(<args>)<?+retParams> -> <retParams></+retParams> {
 				<body>
 			}
@@ -76,6 +60,131 @@ string MultiUseYulFunctionCollector::createFunction(
 		("retParams", joinHumanReadable(returnParameters))
 		("body", body)
 		.render();
-	}
+	};
+}
+
+}
+
+string MultiUseYulFunctionCollector::requestedFunctions()
+{
+	string result = move(m_code);
+	m_code.clear();
+	m_requestedFunctions.clear();
+	return result;
+}
+
+string MultiUseYulFunctionCollector::createFunction(string const& _name, function<string ()> const& _creator)
+{
+	return createFunction(_name, _creator, Sharing::None);
+}
+
+string MultiUseYulFunctionCollector::createFunction(
+	string const& _name,
+	function<string(vector<string>&, vector<string>&)> const& _creator
+)
+{
+	return createFunction(_name, wrapFunctionBody(_name, _creator), Sharing::None);
+}
+
+string MultiUseYulFunctionCollector::createSharedFunction(
+	string const& _name,
+	function<string ()> const& _creator,
+	bool _astIndependent
+)
+{
+	return createFunction(_name, _creator, _astIndependent ? Sharing::ASTIndependent : Sharing::Compilation);
+}
+
+string MultiUseYulFunctionCollector::createSharedFunction(
+	string const& _name,
+	function<string(vector<string>&, vector<string>&)> const& _creator
+)
+{
+	return createFunction(_name, wrapFunctionBody(_name, _creator), Sharing::Compilation);
+}
+
+string MultiUseYulFunctionCollector::createFunction(
+	string const& _name,
+	function<string()> const& _creator,
+	Sharing _sharing
+)
+{
+	solAssert(!_name.empty(), "");
+	if (!m_dependencies.empty())
+		m_dependencies.back().emplace_back(_name);
+	if (m_requestedFunctions.count(_name))
+		return _name;
+
+	// Functions requested by AST-independent functions do not depend on the AST either.
+	if (_sharing == Sharing::Compilation && m_astIndependent)
+		_sharing = Sharing::ASTIndependent;
+
+	if (_sharing != Sharing::None)
+		if (auto cached = findCached(_name))
+		{
+			addCachedFunction(_name, *cached);
+			return _name;
+		}
+
+	m_requestedFunctions.insert(_name);
+	m_dependencies.emplace_back();
+	bool const outerASTIndependent = m_astIndependent;
+	m_astIndependent = _sharing == Sharing::ASTIndependent;
+	ScopeGuard restore([&]() {
+		m_dependencies.pop_back();
+		m_astIndependent = outerASTIndependent;
+	});
+	string fun = _creator();
+	solAssert(!fun.empty(), "");
+	solAssert(fun.find("function " + _name + "(") != string::npos, "Function not properly named.");
+
+	// Functions that depend on non-shared functions cannot be re-created from the cache alone.
+	// Functions in the AST-independent cache may only depend on functions in that cache.
+	auto store = [&](MultiUseYulFunctionCache& _cache, auto const& _findDependency) {
+		MultiUseYulFunctionCache::Function function{fun, {}};
+		for (string const& dependency: m_dependencies.back())
+			if (auto cached = _findDependency(dependency))
+				function.dependencies.emplace_back(dependency, move(cached));
+			else
+				return;
+		_cache.store(cacheKey(_name), move(function));
+	};
+	if (_sharing == Sharing::ASTIndependent && m_astIndependentCache)
+		store(*m_astIndependentCache, [&](string const& _dependency) {
+			return m_astIndependentCache->find(cacheKey(_dependency));
+		});
+	else if (_sharing == Sharing::Compilation && m_cache)
+		store(*m_cache, [&](string const& _dependency) { return findCached(_dependency); });
+
+	m_code += move(fun);
 	return _name;
 }
+
+void MultiUseYulFunctionCollector::addCachedFunction(
+	string const& _name,
+	MultiUseYulFunctionCache::Function const& _function
+)
+{
+	// Replays the requests made while the function was generated, so that the functions
+	// end up in the same order as if they were generated again.
+	m_requestedFunctions.insert(_name);
+	for (auto const& [name, dependency]: _function.dependencies)
+		if (!m_requestedFunctions.count(name))
+			addCachedFunction(name, *dependency);
+	m_code += _function.code;
+}
+
+shared_ptr<MultiUseYulFunctionCache::Function const> MultiUseYulFunctionCollector::findCached(string const& _name) const
+{
+	if (m_cache)
+		if (auto cached = m_cache->find(cacheKey(_name)))
+			return cached;
+	if (m_astIndependentCache)
+		return m_astIndependentCache->find(cacheKey(_name));
+	return nullptr;
+}
+
+MultiUseYulFunctionCache::Key MultiUseYulFunctionCollector::cacheKey(string const& _name) const
+{
+	return {m_evmVersion, m_revertStrings, _name};
+}
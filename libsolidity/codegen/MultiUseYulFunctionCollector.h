@@ -22,10 +22,17 @@
 
 #pragma once
 
+#include <libsolidity/codegen/MultiUseYulFunctionCache.h>
+#include <libsolidity/interface/DebugSettings.h>
+
+#include <liblangutil/EVMVersion.h>
+
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <set>
+#include <vector>
 
 namespace solidity::frontend
 {
@@ -37,6 +44,23 @@ namespace solidity::frontend
 class MultiUseYulFunctionCollector
 {
 public:
+	/// Creates a collector that shares the functions created via createSharedFunction with
+	/// all other collectors using @a _cache, which can be null.
+	/// Functions that do not depend on the AST are shared via @a _astIndependentCache instead,
+	/// which can be null as well and can outlive the compilation.
+	/// @a _evmVersion and @a _revertStrings have to be the settings the functions are generated for.
+	MultiUseYulFunctionCollector(
+		std::shared_ptr<MultiUseYulFunctionCache> _cache,
+		langutil::EVMVersion _evmVersion,
+		RevertStrings _revertStrings,
+		std::shared_ptr<MultiUseYulFunctionCache> _astIndependentCache = nullptr
+	):
+		m_cache(std::move(_cache)),
+		m_astIndependentCache(std::move(_astIndependentCache)),
+		m_evmVersion(_evmVersion),
+		m_revertStrings(_revertStrings)
+	{}
+
 	/// Helper function that uses @a _creator to create a function and add it to
 	/// @a m_requestedFunctions if it has not been created yet and returns @a _name in both
 	/// cases.
@@ -47,6 +71,24 @@ public:
 		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
 	);
 
+	/// Same as createFunction, but takes the function from the cache (if any), if it has been
+	/// created before by another collector, and stores it there otherwise.
+	/// Must only be used for functions whose code only depends on their name, the EVM version
+	/// and the revert strings setting.
+	/// If @a _astIndependent is true, neither the function nor any function requested while
+	/// creating it may depend on the AST. Such functions are shared via the AST-independent
+	/// cache, even by collectors without a cache for the compilation.
+	std::string createSharedFunction(
+		std::string const& _name,
+		std::function<std::string()> const& _creator,
+		bool _astIndependent = false
+	);
+
+	std::string createSharedFunction(
+		std::string const& _name,
+		std::function<std::string(std::vector<std::string>&, std::vector<std::string>&)> const& _creator
+	);
+
 	/// @returns concatenation of all generated functions in the order in which they were
 	/// generated.
 	/// Clears the internal list, i.e. calling it again will result in an
@@ -57,8 +99,28 @@ public:
 	bool contains(std::string const& _name) const { return m_requestedFunctions.count(_name) > 0; }
 
 private:
+	enum class Sharing { None, Compilation, ASTIndependent };
+
+	std::string createFunction(std::string const& _name, std::function<std::string()> const& _creator, Sharing _sharing);
+	/// Adds the cached @a _function named @a _name and the functions it depends on.
+	void addCachedFunction(std::string const& _name, MultiUseYulFunctionCache::Function const& _function);
+	/// @returns the function named @a _name from the cache or the AST-independent cache or nullptr
+	/// if it is not cached.
+	std::shared_ptr<MultiUseYulFunctionCache::Function const> findCached(std::string const& _name) const;
+	MultiUseYulFunctionCache::Key cacheKey(std::string const& _name) const;
+
 	std::set<std::string> m_requestedFunctions;
 	std::string m_code;
+
+	std::shared_ptr<MultiUseYulFunctionCache> m_cache;
+	std::shared_ptr<MultiUseYulFunctionCache> m_astIndependentCache;
+	langutil::EVMVersion m_evmVersion;
+	RevertStrings m_revertStrings = RevertStrings::Default;
+	/// For each function currently being created, the names of the functions requested so far
+	/// while creating it.
+	std::vector<std::vector<std::string>> m_dependencies;
+	/// True while an AST-independent function is being created.
+	bool m_astIndependent = false;
 };
 
 }
@@ -40,6 +40,8 @@
 
 #include <liblangutil/SourceReferenceFormatter.h>
 
+#include <boost/algorithm/string/replace.hpp>
+
 #include <sstream>
 #include <variant>
 
@@ -52,6 +54,22 @@ using namespace solidity::util;
 namespace
 {
 
+string const experimentalWarning =
+	"/*=====================================================*\n"
+	" *                       WARNING                       *\n"
+	" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
+	" *       It can result in LOSS OF FUNDS or worse       *\n"
+	" *                !USE AT YOUR OWN RISK!               *\n"
+	" *=====================================================*/\n\n";
+
+/// @returns the empty object that stands in for the IR of @a _contract in the IR of contracts
+/// creating it. It does not clash with other code, because it contains the unique object name
+/// and quotes in string literals and source snippets are always escaped.
+string subObjectPlaceholder(ContractDefinition const& _contract)
+{
+	return "object \"" + IRNames::creationObject(_contract) + "\" { code { } }";
+}
+
 void verifyCallGraph(
 	set<CallableDeclaration const*, ASTNode::CompareByID> const& _expectedCallables,
 	set<FunctionDefinition const*> _generatedFunctions
@@ -87,54 +105,74 @@ set<CallableDeclaration const*, ASTNode::CompareByID> collectReachableCallables(
 
 }
 
-pair<string, string> IRGenerator::run(
+pair<string, shared_ptr<yul::AssemblyStack>> IRGenerator::run(
 	ContractDefinition const& _contract,
 	bytes const& _cborMetadata,
-	map<ContractDefinition const*, string_view const> const& _otherYulSources
+	map<ContractDefinition const*, shared_ptr<yul::Object const>> const& _otherYulObjects
 )
 {
-	string const ir = yul::reindent(generate(_contract, _cborMetadata, _otherYulSources));
+	set<ContractDefinition const*, ASTNode::CompareByID> subObjects;
+	string irWithPlaceholders = generate(_contract, _cborMetadata, subObjects);
+
+	map<yul::YulString, shared_ptr<yul::Object const>> parsedSubObjects;
+	for (ContractDefinition const* subObject: subObjects)
+		parsedSubObjects[yul::YulString{IRNames::creationObject(*subObject)}] = _otherYulObjects.at(subObject);
 
-	yul::AssemblyStack asmStack(
+	auto asmStack = make_shared<yul::AssemblyStack>(
 		m_evmVersion,
 		yul::AssemblyStack::Language::StrictAssembly,
 		m_optimiserSettings,
-		m_context.debugInfoSelection()
+		m_context.debugInfoSelection(),
+		m_optimizedObjectCache
 	);
-	if (!asmStack.parseAndAnalyze("", ir))
+	if (!asmStack->parseAndAnalyze("", irWithPlaceholders, parsedSubObjects))
 	{
 		string errorMessage;
-		for (auto const& error: asmStack.errors())
+		for (auto const& error: asmStack->errors())
 			errorMessage += langutil::SourceReferenceFormatter::formatErrorInformation(
 				*error,
-				asmStack.charStream("")
+				asmStack->charStream("")
 			);
-		solAssert(false, ir + "\n\nInvalid IR generated:\n" + errorMessage + "\n");
+		solAssert(false, irWithPlaceholders + "\n\nInvalid IR generated:\n" + errorMessage + "\n");
 	}
-	asmStack.optimize();
 
-	string warning =
-		"/*=====================================================*\n"
-		" *                       WARNING                       *\n"
-		" *  Solidity to Yul compilation is still EXPERIMENTAL  *\n"
-		" *       It can result in LOSS OF FUNDS or worse       *\n"
-		" *                !USE AT YOUR OWN RISK!               *\n"
-		" *=====================================================*/\n\n";
+	return {move(irWithPlaceholders), move(asmStack)};
+}
 
-	return {warning + ir, warning + asmStack.print(m_context.soliditySourceProvider())};
+string IRGenerator::completeIR(
+	ContractDefinition const& _contract,
+	string _irWithPlaceholders,
+	function<string const&(ContractDefinition const&)> const& _otherYulSource
+)
+{
+	for (auto const& [dependency, referencee]: _contract.annotation().contractDependencies)
+	{
+		string placeholder = subObjectPlaceholder(*dependency);
+		if (_irWithPlaceholders.find(placeholder) != string::npos)
+			boost::replace_all(_irWithPlaceholders, placeholder, _otherYulSource(*dependency));
+	}
+	return experimentalWarning + yul::reindent(_irWithPlaceholders);
+}
+
+string IRGenerator::printOptimized(yul::AssemblyStack const& _stack) const
+{
+	return experimentalWarning + _stack.print(m_context.soliditySourceProvider());
 }
 
 string IRGenerator::generate(
 	ContractDefinition const& _contract,
 	bytes const& _cborMetadata,
-	map<ContractDefinition const*, string_view const> const& _otherYulSources
+	set<ContractDefinition const*, ASTNode::CompareByID>& _subObjects
 )
 {
-	auto subObjectSources = [&_otherYulSources](std::set<ContractDefinition const*, ASTNode::CompareByID> const& subObjects) -> string
+	auto subObjectSources = [&_subObjects](std::set<ContractDefinition const*, ASTNode::CompareByID> const& subObjects) -> string
 	{
 		std::string subObjectsSources;
 		for (ContractDefinition const* subObject: subObjects)
-			subObjectsSources += _otherYulSources.at(subObject);
+		{
+			subObjectsSources += subObjectPlaceholder(*subObject);
+			_subObjects.insert(subObject);
+		}
 		return subObjectsSources;
 	};
 	auto formatUseSrcMap = [](IRGenerationContext const& _context) -> string
@@ -1106,7 +1144,9 @@ void IRGenerator::resetContext(ContractDefinition const& _contract, ExecutionCon
 		m_optimiserSettings,
 		m_context.sourceIndices(),
 		m_context.debugInfoSelection(),
-		m_context.soliditySourceProvider()
+		m_context.soliditySourceProvider(),
+		m_functionCache,
+		m_astIndependentFunctionCache
 	);
 	newContext.copyFunctionIDsFrom(m_context);
 	m_context = move(newContext);
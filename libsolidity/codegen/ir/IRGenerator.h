@@ -32,8 +32,17 @@
 #include <liblangutil/CharStreamProvider.h>
 #include <liblangutil/EVMVersion.h>
 
+#include <functional>
+#include <memory>
 #include <string>
 
+namespace solidity::yul
+{
+class AssemblyStack;
+class OptimizedObjectCache;
+struct Object;
+}
+
 namespace solidity::frontend
 {
 
@@ -50,10 +59,16 @@ public:
 		OptimiserSettings _optimiserSettings,
 		std::map<std::string, unsigned> _sourceIndices,
 		langutil::DebugInfoSelection const& _debugInfoSelection,
-		langutil::CharStreamProvider const* _soliditySourceProvider
+		langutil::CharStreamProvider const* _soliditySourceProvider,
+		std::shared_ptr<yul::OptimizedObjectCache> _optimizedObjectCache,
+		std::shared_ptr<MultiUseYulFunctionCache> _functionCache,
+		std::shared_ptr<MultiUseYulFunctionCache> _astIndependentFunctionCache
 	):
 		m_evmVersion(_evmVersion),
 		m_optimiserSettings(_optimiserSettings),
+		m_optimizedObjectCache(std::move(_optimizedObjectCache)),
+		m_functionCache(_functionCache),
+		m_astIndependentFunctionCache(_astIndependentFunctionCache),
 		m_context(
 			_evmVersion,
 			ExecutionContext::Creation,
@@ -61,24 +76,43 @@ public:
 			std::move(_optimiserSettings),
 			std::move(_sourceIndices),
 			_debugInfoSelection,
-			_soliditySourceProvider
+			_soliditySourceProvider,
+			std::move(_functionCache),
+			std::move(_astIndependentFunctionCache)
 		),
 		m_utils(_evmVersion, m_context.revertStrings(), m_context.functionCollector())
 	{}
 
-	/// Generates and returns the IR code, in unoptimized and optimized form
-	/// (or just pretty-printed, depending on the optimizer settings).
-	std::pair<std::string, std::string> run(
+	/// Generates and returns the IR code in unoptimized form, together with an assembly stack
+	/// holding the parsed and analyzed code. The stack can be optimized and used for code
+	/// generation directly, without printing and re-parsing the code.
+	/// The returned code only contains placeholders for the IR of the contracts created by
+	/// @a _contract, see @a completeIR. Instead of parsing that IR again, the stack embeds copies
+	/// of the parsed objects in @a _otherYulObjects.
+	std::pair<std::string, std::shared_ptr<yul::AssemblyStack>> run(
 		ContractDefinition const& _contract,
 		bytes const& _cborMetadata,
-		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources
+		std::map<ContractDefinition const*, std::shared_ptr<yul::Object const>> const& _otherYulObjects
 	);
 
+	/// @returns the complete IR code of @a _contract, given the code returned by @a run, by filling
+	/// in the IR of the contracts it creates as provided by @a _otherYulSource.
+	static std::string completeIR(
+		ContractDefinition const& _contract,
+		std::string _irWithPlaceholders,
+		std::function<std::string const&(ContractDefinition const&)> const& _otherYulSource
+	);
+
+	/// @returns the pretty-printed code of an assembly stack returned by @a run after optimizing it.
+	std::string printOptimized(yul::AssemblyStack const& _stack) const;
+
 private:
+	/// Generates the IR code of @a _contract. The contracts it creates are only represented by
+	/// empty placeholder objects and added to @a _subObjects.
 	std::string generate(
 		ContractDefinition const& _contract,
 		bytes const& _cborMetadata,
-		std::map<ContractDefinition const*, std::string_view const> const& _otherYulSources
+		std::set<ContractDefinition const*, ASTNode::CompareByID>& _subObjects
 	);
 	std::string generate(Block const& _block);
 
@@ -136,6 +170,12 @@ private:
 
 	langutil::EVMVersion const m_evmVersion;
 	OptimiserSettings const m_optimiserSettings;
+	/// Sub-objects already optimized for other contracts, can be null.
+	std::shared_ptr<yul::OptimizedObjectCache> m_optimizedObjectCache;
+	/// Utility functions already generated for other contracts, can be null.
+	std::shared_ptr<MultiUseYulFunctionCache> m_functionCache;
+	/// Utility functions independent of the AST, shared with other compilations, can be null.
+	std::shared_ptr<MultiUseYulFunctionCache> m_astIndependentFunctionCache;
 
 	IRGenerationContext m_context;
 	YulUtilFunctions m_utils;
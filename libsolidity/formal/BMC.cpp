@@ -29,6 +29,8 @@
 #include <z3_version.h>
 #endif
 
+#include <chrono>
+
 using namespace std;
 using namespace solidity;
 using namespace solidity::util;
@@ -769,6 +771,7 @@ void BMC::checkUnderflow(BMCVerificationTarget& _target)
 		intType = TypeProvider::uint256();
 
 	checkCondition(
+		VerificationTargetType::Underflow,
 		_target.constraints && _target.value < smt::minValue(*intType),
 		_target.callStack,
 		_target.modelExpressions,
@@ -802,6 +805,7 @@ void BMC::checkOverflow(BMCVerificationTarget& _target)
 		intType = TypeProvider::uint256();
 
 	checkCondition(
+		VerificationTargetType::Overflow,
 		_target.constraints && _target.value > smt::maxValue(*intType),
 		_target.callStack,
 		_target.modelExpressions,
@@ -825,6 +829,7 @@ void BMC::checkDivByZero(BMCVerificationTarget& _target)
 		return;
 
 	checkCondition(
+		VerificationTargetType::DivByZero,
 		_target.constraints && (_target.value == 0),
 		_target.callStack,
 		_target.modelExpressions,
@@ -841,6 +846,7 @@ void BMC::checkBalance(BMCVerificationTarget& _target)
 {
 	solAssert(_target.type == VerificationTargetType::Balance, "");
 	checkCondition(
+		VerificationTargetType::Balance,
 		_target.constraints && _target.value,
 		_target.callStack,
 		_target.modelExpressions,
@@ -863,6 +869,7 @@ void BMC::checkAssert(BMCVerificationTarget& _target)
 		return;
 
 	checkCondition(
+		VerificationTargetType::Assert,
 		_target.constraints && !_target.value,
 		_target.callStack,
 		_target.modelExpressions,
@@ -901,6 +908,7 @@ void BMC::addVerificationTarget(
 /// Solving.
 
 void BMC::checkCondition(
+	VerificationTargetType _type,
 	smtutil::Expression _condition,
 	vector<SMTEncoder::CallStackEntry> const& _callStack,
 	pair<vector<smtutil::Expression>, vector<string>> const& _modelExpressions,
@@ -924,10 +932,31 @@ void BMC::checkCondition(
 			expressionsToEvaluate.emplace_back(*_additionalValue);
 			expressionNames.push_back(_additionalValueName);
 		}
+
+	auto const start = chrono::steady_clock::now();
+
 	smtutil::CheckResult result;
 	vector<string> values;
 	tie(result, values) = checkSatisfiableAndGenerateModel(expressionsToEvaluate);
 
+	if (m_settings.showQueryStats)
+	{
+		auto const time = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+		auto const* portfolio = dynamic_cast<smtutil::SMTPortfolio const*>(m_interface.get());
+		solAssert(portfolio, "");
+		m_queryStats.push_back({
+			"bmc",
+			portfolio->answeringSolver(),
+			_type,
+			_location,
+			result,
+			time,
+			{},
+			{},
+			m_interface->lastQuerySize()
+		});
+	}
+
 	string extraComment = SMTEncoder::extraComment();
 	if (m_loopExecutionHappened)
 		extraComment +=
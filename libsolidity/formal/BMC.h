@@ -30,6 +30,7 @@
 
 
 #include <libsolidity/formal/EncodingContext.h>
+#include <libsolidity/formal/ModelCheckerQueryStats.h>
 #include <libsolidity/formal/ModelCheckerSettings.h>
 #include <libsolidity/formal/SMTEncoder.h>
 
@@ -73,6 +74,10 @@ public:
 	/// the constructor.
 	std::vector<std::string> unhandledQueries() { return m_interface->unhandledQueries(); }
 
+	/// @returns statistics about the queries for the verification targets,
+	/// if requested via the settings.
+	std::vector<ModelCheckerQueryStats> const& queryStats() const { return m_queryStats; }
+
 	/// @returns true if _funCall should be inlined, otherwise false.
 	/// @param _scopeContract The contract that contains the current function being analyzed.
 	/// @param _contextContract The most derived contract, currently being analyzed.
@@ -156,6 +161,7 @@ private:
 	//@{
 	/// Check that a condition can be satisfied.
 	void checkCondition(
+		VerificationTargetType _type,
 		smtutil::Expression _condition,
 		std::vector<CallStackEntry> const& _callStack,
 		std::pair<std::vector<smtutil::Expression>, std::vector<std::string>> const& _modelExpressions,
@@ -193,6 +199,9 @@ private:
 
 	/// Number of verification conditions that could not be proved.
 	size_t m_unprovedAmt = 0;
+
+	/// Collected only if ModelCheckerSettings::showQueryStats is set.
+	std::vector<ModelCheckerQueryStats> m_queryStats;
 };
 
 }
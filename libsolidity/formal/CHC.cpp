@@ -46,6 +46,7 @@
 #include <range/v3/view/reverse.hpp>
 
 #include <charconv>
+#include <chrono>
 #include <queue>
 
 using namespace std;
@@ -601,7 +602,7 @@ void CHC::endVisit(IndexRangeAccess const& _range)
 	if (!sliceData.first)
 	{
 		for (auto pred: sliceData.second.predicates)
-			m_interface->registerRelation(pred->functor());
+			registerRelation(pred->functor());
 		for (auto const& rule: sliceData.second.rules)
 			addRule(rule, "");
 	}
@@ -989,6 +990,8 @@ void CHC::resetSourceAnalysis()
 	Predicate::reset();
 	ArraySlicePredicate::reset();
 	m_blockCounter = 0;
+	m_relationCount = 0;
+	m_ruleCount = 0;
 
 	bool usesZ3 = false;
 #ifdef HAVE_Z3
@@ -1123,7 +1126,7 @@ SortPointer CHC::sort(ASTNode const* _node)
 Predicate const* CHC::createSymbolicBlock(SortPointer _sort, string const& _name, PredicateType _predType, ASTNode const* _node, ContractDefinition const* _contractContext)
 {
 	auto const* block = Predicate::create(_sort, _name, _predType, m_context, _node, _contractContext, m_scopes);
-	m_interface->registerRelation(block->functor());
+	registerRelation(block->functor());
 	return block;
 }
 
@@ -1355,7 +1358,7 @@ void CHC::createErrorBlock()
 		"error_target_" + to_string(m_context.newUniqueId()),
 		PredicateType::Error
 	);
-	m_interface->registerRelation(m_errorPredicate->functor());
+	registerRelation(m_errorPredicate->functor());
 }
 
 void CHC::connectBlocks(smtutil::Expression const& _from, smtutil::Expression const& _to, smtutil::Expression const& _constraints)
@@ -1527,9 +1530,16 @@ smtutil::Expression CHC::predicate(FunctionCall const& _funCall)
 	return callPredicate(args);
 }
 
+void CHC::registerRelation(smtutil::Expression const& _relation)
+{
+	m_interface->registerRelation(_relation);
+	++m_relationCount;
+}
+
 void CHC::addRule(smtutil::Expression const& _rule, string const& _ruleName)
 {
 	m_interface->addRule(_rule, _ruleName);
+	++m_ruleCount;
 }
 
 tuple<CheckResult, smtutil::Expression, CHCSolverInterface::CexGraph> CHC::query(smtutil::Expression const& _query, langutil::SourceLocation const& _location)
@@ -1797,7 +1807,28 @@ void CHC::checkAndReportTarget(
 			placeholder.constraints && placeholder.errorExpression == _target.errorId
 		);
 	auto const& location = _target.errorNode->location();
+
+	auto const start = chrono::steady_clock::now();
+
 	auto [result, invariant, model] = query(error(), location);
+
+	if (m_settings.showQueryStats)
+	{
+		auto const time = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+		m_queryStats.push_back({
+			"chc",
+			result == CheckResult::SATISFIABLE || result == CheckResult::UNSATISFIABLE ?
+				make_optional(m_interface->solverName()) :
+				nullopt,
+			_target.type,
+			location,
+			result,
+			time,
+			m_relationCount,
+			m_ruleCount,
+			m_interface->lastQuerySize()
+		});
+	}
 	if (result == CheckResult::UNSATISFIABLE)
 	{
 		m_safeTargets[_target.errorNode].insert(_target.type);
@@ -31,6 +31,7 @@
 
 #pragma once
 
+#include <libsolidity/formal/ModelCheckerQueryStats.h>
 #include <libsolidity/formal/ModelCheckerSettings.h>
 #include <libsolidity/formal/Predicate.h>
 #include <libsolidity/formal/SMTEncoder.h>
@@ -79,6 +80,10 @@ public:
 	/// the constructor.
 	std::vector<std::string> unhandledQueries() const;
 
+	/// @returns statistics about the queries for the verification targets,
+	/// if requested via the settings.
+	std::vector<ModelCheckerQueryStats> const& queryStats() const { return m_queryStats; }
+
 	enum class CHCNatspecOption
 	{
 		AbstractFunctionNondet
@@ -243,6 +248,8 @@ private:
 
 	/// Solver related.
 	//@{
+	/// Registers a predicate with the solver.
+	void registerRelation(smtutil::Expression const& _relation);
 	/// Adds Horn rule to the solver.
 	void addRule(smtutil::Expression const& _rule, std::string const& _ruleName);
 	/// @returns <true, invariant, empty> if query is unsatisfiable (safe).
@@ -383,6 +390,9 @@ private:
 
 	/// Inferred invariants.
 	std::map<Predicate const*, std::set<std::string>, PredicateCompare> m_invariants;
+
+	/// Collected only if ModelCheckerSettings::showQueryStats is set.
+	std::vector<ModelCheckerQueryStats> m_queryStats;
 	//@}
 
 	/// Control-flow.
@@ -421,6 +431,12 @@ private:
 
 	/// CHC solver.
 	std::unique_ptr<smtutil::CHCSolverInterface> m_interface;
+
+	/// Size of the Horn system given to the solver for the current source.
+	//@{
+	size_t m_relationCount = 0;
+	size_t m_ruleCount = 0;
+	//@}
 };
 
 }
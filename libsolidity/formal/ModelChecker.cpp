@@ -135,6 +135,11 @@ vector<string> ModelChecker::unhandledQueries()
 	return m_bmc.unhandledQueries() + m_chc.unhandledQueries();
 }
 
+vector<ModelCheckerQueryStats> ModelChecker::queryStats() const
+{
+	return m_chc.queryStats() + m_bmc.queryStats();
+}
+
 solidity::smtutil::SMTSolverChoice ModelChecker::availableSolvers()
 {
 	smtutil::SMTSolverChoice available = smtutil::SMTSolverChoice::SMTLIB2();
@@ -26,6 +26,7 @@
 #include <libsolidity/formal/BMC.h>
 #include <libsolidity/formal/CHC.h>
 #include <libsolidity/formal/EncodingContext.h>
+#include <libsolidity/formal/ModelCheckerQueryStats.h>
 #include <libsolidity/formal/ModelCheckerSettings.h>
 
 #include <libsolidity/interface/ReadFile.h>
@@ -71,6 +72,10 @@ public:
 	/// the constructor.
 	std::vector<std::string> unhandledQueries();
 
+	/// @returns statistics about all solver queries of both engines
+	/// if ModelCheckerSettings::showQueryStats is set, and an empty list otherwise.
+	std::vector<ModelCheckerQueryStats> queryStats() const;
+
 	/// @returns SMT solvers that are available via the C++ API.
 	static smtutil::SMTSolverChoice availableSolvers();
 
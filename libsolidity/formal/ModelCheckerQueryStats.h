@@ -0,0 +1,58 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Statistics about the solver queries issued by the model checking engines.
+ */
+
+#pragma once
+
+#include <libsolidity/formal/ModelCheckerSettings.h>
+
+#include <libsmtutil/SolverInterface.h>
+
+#include <liblangutil/SourceLocation.h>
+
+#include <chrono>
+#include <optional>
+#include <string>
+
+namespace solidity::frontend
+{
+
+/// Information about a single query for a verification target.
+/// Only collected if ModelCheckerSettings::showQueryStats is set.
+struct ModelCheckerQueryStats
+{
+	/// "bmc" or "chc".
+	std::string engine;
+	/// The solver whose answer is the result, if any solver answered.
+	std::optional<std::string> solver;
+	VerificationTargetType target;
+	langutil::SourceLocation location;
+	smtutil::CheckResult result;
+	/// Wall time spent waiting for the solver(s).
+	std::chrono::microseconds time;
+	/// Number of predicates (CHC only).
+	std::optional<size_t> predicates;
+	/// Number of Horn rules (CHC only).
+	std::optional<size_t> rules;
+	/// Size in bytes of the query sent to the solver in SMT-LIB2 format, if available.
+	std::optional<size_t> smtlib2Size;
+};
+
+}
@@ -153,6 +153,8 @@ struct ModelCheckerSettings
 	ModelCheckerEngine engine = ModelCheckerEngine::None();
 	ModelCheckerInvariants invariants = ModelCheckerInvariants::Default();
 	bool showUnproved = false;
+	/// Collect timing and size information for every solver query.
+	bool showQueryStats = false;
 	smtutil::SMTSolverChoice solvers = smtutil::SMTSolverChoice::All();
 	ModelCheckerTargets targets = ModelCheckerTargets::Default();
 	std::optional<unsigned> timeout;
@@ -166,6 +168,7 @@ struct ModelCheckerSettings
 			engine == _other.engine &&
 			invariants == _other.invariants &&
 			showUnproved == _other.showUnproved &&
+			showQueryStats == _other.showQueryStats &&
 			solvers == _other.solvers &&
 			targets == _other.targets &&
 			timeout == _other.timeout;
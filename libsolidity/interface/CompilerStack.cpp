@@ -65,6 +65,7 @@
 #include <libyul/AssemblyStack.h>
 #include <libyul/AST.h>
 #include <libyul/AsmParser.h>
+#include <libyul/optimiser/OptimiserProfile.h>
 
 #include <liblangutil/Scanner.h>
 #include <liblangutil/SemVerHandler.h>
@@ -75,14 +76,17 @@
 #include <libsolutil/IpfsHash.h>
 #include <libsolutil/JSON.h>
 #include <libsolutil/Algorithms.h>
+#include <libsolutil/ThreadPool.h>
 
 #include <json/json.h>
 
 #include <boost/algorithm/string/replace.hpp>
 
+#include <future>
 #include <utility>
 #include <map>
 #include <limits>
+#include <optional>
 #include <string>
 
 using namespace std;
@@ -290,18 +294,25 @@ void CompilerStack::reset(bool _keepSettings)
 {
 	m_stackState = Empty;
 	m_hasError = false;
+	m_optimizedObjectCache.reset();
+	m_yulFunctionCache.reset();
 	m_sources.clear();
 	m_smtlib2Responses.clear();
 	m_unhandledSMTLib2Queries.clear();
+	m_modelCheckerQueryStats.clear();
+	m_phaseTimings.clear();
 	if (!_keepSettings)
 	{
 		m_importRemapper.clear();
 		m_libraries.clear();
 		m_viaIR = false;
+		m_parserThreads = 0;
 		m_evmVersion = langutil::EVMVersion();
 		m_modelCheckerSettings = ModelCheckerSettings{};
 		m_generateIR = false;
 		m_generateEwasm = false;
+		m_profileIROptimizer = false;
+		m_phaseTimings.enable(false);
 		m_revertStrings = RevertStrings::Default;
 		m_optimiserSettings = OptimiserSettings::minimal();
 		m_metadataLiteralSources = false;
@@ -321,8 +332,8 @@ void CompilerStack::setSources(StringMap _sources)
 		solThrow(CompilerError, "Cannot change sources once set.");
 	if (m_stackState != Empty)
 		solThrow(CompilerError, "Must set sources before parsing.");
-	for (auto source: _sources)
-		m_sources[source.first].charStream = make_unique<CharStream>(/*content*/std::move(source.second), /*name*/source.first);
+	for (auto& [name, content]: _sources)
+		m_sources[name].charStream = make_unique<CharStream>(std::move(content), name);
 	m_stackState = SourcesSet;
 }
 
@@ -331,6 +342,7 @@ bool CompilerStack::parse()
 	if (m_stackState != SourcesSet)
 		solThrow(CompilerError, "Must call parse only after the SourcesSet state.");
 	m_errorReporter.clear();
+	util::PhaseTimer timer(m_phaseTimings, "parsing");
 
 	if (SemVerVersion{string(VersionString)}.isPrerelease())
 		m_errorReporter.warning(3805_error, "This is a pre-release compiler version, please do not use it in production.");
@@ -341,11 +353,108 @@ bool CompilerStack::parse()
 	for (auto const& s: m_sources)
 		sourcesToParse.push_back(s.first);
 
+	// If enabled, as soon as more than one source is waiting to be parsed, the pending sources are parsed
+	// concurrently, each by its own parser with its own error list. The results are consumed
+	// in the order of a sequential run, so imports are discovered and node IDs are assigned
+	// exactly as if all sources were parsed one after the other.
+	// Node IDs are consecutive across sources, so the ID offset a source is parsed with depends
+	// on the number of nodes of all sources before it. Every pending source is therefore first
+	// parsed assuming no nodes precede it, which yields its number of nodes, and parsed again
+	// with its actual offset as soon as that is known. The first parse is used directly if the
+	// offset turns out to be right, i.e. for the first source.
+	struct ParsingJob
+	{
+		ParsingJob(EVMVersion _evmVersion, bool _errorRecovery, int64_t _idOffset):
+			idOffset(_idOffset),
+			parser(errorReporter, _evmVersion, _errorRecovery, _idOffset)
+		{
+			parser.setConcurrent();
+		}
+		int64_t nodeCount() const { return parser.lastNodeID() - idOffset; }
+		int64_t idOffset;
+		ErrorList errors;
+		ErrorReporter errorReporter{errors};
+		Parser parser;
+		ASTPointer<SourceUnit> ast;
+	};
+	struct PendingSource
+	{
+		/// Parses the source with the ID offset known when it was submitted, usually zero.
+		shared_future<unique_ptr<ParsingJob>> counting;
+		/// Parses the source with the ID offset it gets in a sequential run.
+		shared_future<unique_ptr<ParsingJob>> parsing;
+	};
+	optional<util::ThreadPool> threadPool;
+	map<size_t, PendingSource> pendingSources;
+	size_t submittedSources = 0;
+	int64_t lastNodeID = 0;
+
+	auto submit = [&](size_t _index, int64_t _idOffset) {
+		CharStream& charStream = *m_sources[sourcesToParse[_index]].charStream;
+		return threadPool->submit([&charStream, _idOffset, this]() {
+			auto job = make_unique<ParsingJob>(m_evmVersion, m_parserErrorRecovery, _idOffset);
+			job->ast = job->parser.parse(charStream);
+			return job;
+		}).share();
+	};
+
 	for (size_t i = 0; i < sourcesToParse.size(); ++i)
 	{
+		if (m_parserThreads > 0 && sourcesToParse.size() - i > 1)
+		{
+			if (!threadPool)
+				threadPool.emplace(m_parserThreads);
+			for (size_t j = max(submittedSources, i); j < sourcesToParse.size(); ++j)
+				pendingSources[j].counting = submit(j, j == i ? lastNodeID : 0);
+			submittedSources = sourcesToParse.size();
+		}
+
+		// Determine the ID offsets of the pending sources in order, up to the first one with errors.
+		int64_t idOffset = lastNodeID;
+		for (size_t j = i; j < submittedSources; ++j)
+		{
+			PendingSource& pending = pendingSources.at(j);
+			ParsingJob const& counted = *pending.counting.get();
+			if (!counted.errors.empty())
+				break;
+			if (!pending.parsing.valid())
+				pending.parsing = counted.idOffset == idOffset ? pending.counting : submit(j, idOffset);
+			idOffset += counted.nodeCount();
+		}
+
 		string const& path = sourcesToParse[i];
 		Source& source = m_sources[path];
-		source.ast = parser.parse(*source.charStream);
+		bool parsed = false;
+		if (auto pending = pendingSources.find(i); pending != pendingSources.end())
+		{
+			if (pending->second.parsing.valid())
+				if (ParsingJob& result = *pending->second.parsing.get(); result.errors.empty())
+				{
+					solAssert(result.idOffset == lastNodeID, "");
+					source.ast = move(result.ast);
+					lastNodeID = result.parser.lastNodeID();
+					parsed = true;
+				}
+			pendingSources.erase(pending);
+		}
+		// Sources for which anything, including only warnings, was reported are parsed again on
+		// this thread, so that their errors go through m_errorReporter in the order of a sequential
+		// run and are subject to its limit on the number of errors. This is covered by the
+		// concurrent_parsing_matches_sequential_parsing test. Since the workers may still be
+		// parsing other sources, such a parser has to take the inline assembly lock as well.
+		if (!parsed)
+		{
+			optional<Parser> concurrentParser;
+			if (threadPool)
+			{
+				concurrentParser.emplace(m_errorReporter, m_evmVersion, m_parserErrorRecovery, lastNodeID);
+				concurrentParser->setConcurrent();
+			}
+			Parser& sourceParser = concurrentParser ? *concurrentParser : parser;
+			solAssert(sourceParser.lastNodeID() == lastNodeID, "");
+			source.ast = sourceParser.parse(*source.charStream);
+			lastNodeID = sourceParser.lastNodeID();
+		}
 		if (!source.ast)
 			solAssert(Error::containsErrors(m_errorReporter.errors()), "Parser returned null but did not report error.");
 		else
@@ -366,11 +475,9 @@ bool CompilerStack::parse()
 			}
 
 			if (m_stopAfter >= ParsedAndImported)
-				for (auto const& newSource: loadMissingSources(*source.ast))
+				for (auto& [newPath, newContents]: loadMissingSources(*source.ast))
 				{
-					string const& newPath = newSource.first;
-					string const& newContents = newSource.second;
-					m_sources[newPath].charStream = make_shared<CharStream>(newContents, newPath);
+					m_sources[newPath].charStream = make_shared<CharStream>(std::move(newContents), newPath);
 					sourcesToParse.push_back(newPath);
 				}
 		}
@@ -392,6 +499,7 @@ void CompilerStack::importASTs(map<string, Json::Value> const& _sources)
 {
 	if (m_stackState != Empty)
 		solThrow(CompilerError, "Must call importASTs only before the SourcesSet state.");
+	util::PhaseTimer timer(m_phaseTimings, "astImport");
 	m_sourceJsons = _sources;
 	map<string, ASTPointer<SourceUnit>> reconstructedSources = ASTJsonImporter(m_evmVersion).jsonToSourceUnit(m_sourceJsons);
 	for (auto& src: reconstructedSources)
@@ -415,6 +523,7 @@ bool CompilerStack::analyze()
 {
 	if (m_stackState != ParsedAndImported || m_stackState >= AnalysisPerformed)
 		solThrow(CompilerError, "Must call analyze only after parsing was performed.");
+	util::PhaseTimer timer(m_phaseTimings, "importResolution");
 	resolveImports();
 
 	for (Source const* source: m_sourceOrder)
@@ -425,11 +534,13 @@ bool CompilerStack::analyze()
 
 	try
 	{
+		timer.next("syntaxChecking");
 		SyntaxChecker syntaxChecker(m_errorReporter, m_optimiserSettings.runYulOptimiser);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !syntaxChecker.checkSyntax(*source->ast))
 				noErrors = false;
 
+		timer.next("nameAndTypeResolution");
 		m_globalContext = make_shared<GlobalContext>();
 		// We need to keep the same resolver during the whole process.
 		NameAndTypeResolver resolver(*m_globalContext, m_evmVersion, m_errorReporter);
@@ -456,6 +567,7 @@ bool CompilerStack::analyze()
 			if (source->ast && !resolver.resolveNamesAndTypes(*source->ast))
 				return false;
 
+		timer.next("declarationChecking");
 		DeclarationTypeChecker declarationTypeChecker(m_errorReporter, m_evmVersion);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !declarationTypeChecker.check(*source->ast))
@@ -489,6 +601,7 @@ bool CompilerStack::analyze()
 		//
 		// Note: this does not resolve overloaded functions. In order to do that, types of arguments are needed,
 		// which is only done one step later.
+		timer.next("typeChecking");
 		TypeChecker typeChecker(m_evmVersion, m_errorReporter);
 		for (Source const* source: m_sourceOrder)
 			if (source->ast && !typeChecker.checkTypeRequirements(*source->ast))
@@ -505,6 +618,7 @@ bool CompilerStack::analyze()
 				noErrors = false;
 		}
 
+		timer.next("staticAnalysis");
 		// Create & assign callgraphs and check for contract dependency cycles
 		if (noErrors)
 		{
@@ -569,6 +683,7 @@ bool CompilerStack::analyze()
 
 		if (noErrors)
 		{
+			timer.next("smtChecker");
 			ModelChecker modelChecker(m_errorReporter, *this, m_smtlib2Responses, m_modelCheckerSettings, m_readFile);
 			auto allSources = applyMap(m_sourceOrder, [](Source const* _source) { return _source->ast; });
 			modelChecker.enableAllEnginesIfPragmaPresent(allSources);
@@ -577,6 +692,7 @@ bool CompilerStack::analyze()
 				if (source->ast)
 					modelChecker.analyze(*source->ast);
 			m_unhandledSMTLib2Queries += modelChecker.unhandledQueries();
+			m_modelCheckerQueryStats += modelChecker.queryStats();
 		}
 	}
 	catch (FatalError const&)
@@ -645,6 +761,11 @@ bool CompilerStack::compile(State _stopAfter)
 
 	// Only compile contracts individually which have been requested.
 	map<ContractDefinition const*, shared_ptr<Compiler const>> otherCompilers;
+	// Contracts created via ``new`` are part of the IR of their creators, but only have to be
+	// optimized once.
+	m_optimizedObjectCache = make_shared<yul::OptimizedObjectCache>();
+	// The same utility functions are needed by most contracts, but only have to be generated once.
+	m_yulFunctionCache = make_shared<MultiUseYulFunctionCache>();
 
 	for (Source const* source: m_sourceOrder)
 		for (ASTPointer<ASTNode> const& node: source->ast->nodes())
@@ -695,6 +816,8 @@ bool CompilerStack::compile(State _stopAfter)
 							throw;
 					}
 				}
+	m_optimizedObjectCache.reset();
+	m_yulFunctionCache.reset();
 	m_stackState = CompilationSuccessful;
 	this->link();
 	return true;
@@ -853,7 +976,7 @@ string const& CompilerStack::yulIR(string const& _contractName) const
 	if (m_stackState != CompilationSuccessful)
 		solThrow(CompilerError, "Compilation was not successful.");
 
-	return contract(_contractName).yulIR;
+	return yulIR(contract(_contractName));
 }
 
 string const& CompilerStack::yulIROptimized(string const& _contractName) const
@@ -864,6 +987,17 @@ string const& CompilerStack::yulIROptimized(string const& _contractName) const
 	return contract(_contractName).yulIROptimized;
 }
 
+Json::Value CompilerStack::yulIROptimizerProfile(string const& _contractName) const
+{
+	if (m_stackState != CompilationSuccessful)
+		solThrow(CompilerError, "Compilation was not successful.");
+
+	Contract const& currentContract = contract(_contractName);
+	if (!currentContract.yulIROptimizerProfile)
+		return Json::nullValue;
+	return currentContract.yulIROptimizerProfile->toJson();
+}
+
 string const& CompilerStack::ewasm(string const& _contractName) const
 {
 	if (m_stackState != CompilationSuccessful)
@@ -1042,6 +1176,21 @@ string const& CompilerStack::metadata(Contract const& _contract) const
 	return _contract.metadata.init([&]{ return createMetadata(_contract, m_viaIR); });
 }
 
+string const& CompilerStack::yulIR(Contract const& _contract) const
+{
+	return _contract.yulIR.init([&]{
+		if (_contract.yulIRWithPlaceholders.empty())
+			return string{};
+		return IRGenerator::completeIR(
+			*_contract.contract,
+			_contract.yulIRWithPlaceholders,
+			[&](ContractDefinition const& _dependency) -> string const& {
+				return yulIR(m_contracts.at(_dependency.fullyQualifiedName()));
+			}
+		);
+	});
+}
+
 CharStream const& CompilerStack::charStream(string const& _sourceName) const
 {
 	if (m_stackState < SourcesSet)
@@ -1125,7 +1274,7 @@ StringMap CompilerStack::loadMissingSources(SourceUnit const& _ast)
 					result = m_readFile(ReadCallback::kindString(ReadCallback::Kind::ReadFile), importPath);
 
 				if (result.success)
-					newSources[importPath] = result.responseOrErrorMessage;
+					newSources[importPath] = std::move(result.responseOrErrorMessage);
 				else
 				{
 					m_errorReporter.parserError(
@@ -1221,6 +1370,7 @@ void CompilerStack::assemble(
 	solAssert(!m_hasError, "");
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
+	util::PhaseTimer timer(m_phaseTimings, "evmAssembly", _contract.fullyQualifiedName());
 
 	compiledContract.evmAssembly = _assembly;
 	solAssert(compiledContract.evmAssembly, "");
@@ -1287,7 +1437,12 @@ void CompilerStack::compileContract(
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
 
-	shared_ptr<Compiler> compiler = make_shared<Compiler>(m_evmVersion, m_revertStrings, m_optimiserSettings);
+	shared_ptr<Compiler> compiler = make_shared<Compiler>(
+		m_evmVersion,
+		m_revertStrings,
+		m_optimiserSettings,
+		m_astIndependentYulFunctionCache
+	);
 	compiledContract.compiler = compiler;
 
 	solAssert(!m_viaIR, "");
@@ -1295,8 +1450,10 @@ void CompilerStack::compileContract(
 
 	try
 	{
-		// Run optimiser and compile the contract.
-		compiler->compileContract(_contract, _otherCompilers, cborEncodedMetadata);
+		util::PhaseTimer timer(m_phaseTimings, "evmCodegen", _contract.fullyQualifiedName());
+		compiler->generateCode(_contract, _otherCompilers, cborEncodedMetadata);
+		timer.next("evmOptimization");
+		compiler->optimise();
 	}
 	catch(evmasm::OptimizerException const&)
 	{
@@ -1315,7 +1472,7 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 		solThrow(CompilerError, "Called generateIR with errors.");
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
-	if (!compiledContract.yulIR.empty())
+	if (!compiledContract.yulIRWithPlaceholders.empty())
 		return;
 
 	if (!*_contract.sourceUnit().annotation().useABICoderV2)
@@ -1333,16 +1490,56 @@ void CompilerStack::generateIR(ContractDefinition const& _contract)
 	if (!_contract.canBeDeployed())
 		return;
 
-	map<ContractDefinition const*, string_view const> otherYulSources;
+	map<ContractDefinition const*, shared_ptr<yul::Object const>> otherYulObjects;
+	bool createdByOtherContract = false;
 	for (auto const& pair: m_contracts)
-		otherYulSources.emplace(pair.second.contract, pair.second.yulIR);
+	{
+		if (pair.second.yulIRObject)
+			otherYulObjects.emplace(pair.second.contract, pair.second.yulIRObject);
+		if (pair.second.contract->annotation().contractDependencies.count(&_contract))
+			createdByOtherContract = true;
+	}
 
-	IRGenerator generator(m_evmVersion, m_revertStrings, m_optimiserSettings, sourceIndices(), m_debugInfoSelection, this);
-	tie(compiledContract.yulIR, compiledContract.yulIROptimized) = generator.run(
+	util::PhaseTimer timer(m_phaseTimings, "irGeneration", _contract.fullyQualifiedName());
+	IRGenerator generator(
+		m_evmVersion,
+		m_revertStrings,
+		m_optimiserSettings,
+		sourceIndices(),
+		m_debugInfoSelection,
+		this,
+		m_optimizedObjectCache,
+		m_yulFunctionCache,
+		m_astIndependentYulFunctionCache
+	);
+	shared_ptr<yul::AssemblyStack> irStack;
+	// The complete IR text is only assembled if it is requested, see yulIR().
+	tie(compiledContract.yulIRWithPlaceholders, irStack) = generator.run(
 		_contract,
 		createCBORMetadata(compiledContract, /* _forIR */ true),
-		otherYulSources
+		otherYulObjects
 	);
+	// Contracts creating this one embed a copy of the parsed object instead of parsing its IR again.
+	if (createdByOtherContract)
+		compiledContract.yulIRObject = irStack->parserResult()->clone();
+	timer.next("yulOptimization");
+	if (m_profileIROptimizer)
+	{
+		// The profile stays attached to the stack, so that it also covers its optimization in generateEVMFromIR().
+		compiledContract.yulIROptimizerProfile = make_shared<yul::OptimiserProfile>();
+		irStack->setOptimiserProfile(compiledContract.yulIROptimizerProfile);
+	}
+	irStack->optimize();
+
+	// The optimized IR is only printed if it was requested or for Ewasm generation.
+	// EVM code is generated from the already parsed and analyzed stack.
+	if (m_generateIR || m_generateEwasm)
+	{
+		timer.next("irPrinting");
+		compiledContract.yulIROptimized = generator.printOptimized(*irStack);
+	}
+	if (m_viaIR && m_generateEvmBytecode && isRequestedContract(_contract))
+		compiledContract.yulIRStack = move(irStack);
 }
 
 void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
@@ -1355,25 +1552,25 @@ void CompilerStack::generateEVMFromIR(ContractDefinition const& _contract)
 		return;
 
 	Contract& compiledContract = m_contracts.at(_contract.fullyQualifiedName());
-	solAssert(!compiledContract.yulIROptimized.empty(), "");
 	if (!compiledContract.object.bytecode.empty())
 		return;
-
-	// Re-parse the Yul IR in EVM dialect
-	yul::AssemblyStack stack(
-		m_evmVersion,
-		yul::AssemblyStack::Language::StrictAssembly,
-		m_optimiserSettings,
-		m_debugInfoSelection
-	);
-	stack.parseAndAnalyze("", compiledContract.yulIROptimized);
-	stack.optimize();
-
-	//cout << yul::AsmPrinter{}(*stack.parserResult()->code) << endl;
-
+	solAssert(compiledContract.yulIRStack, "");
+
+	// The stack already holds the analyzed IR in EVM dialect, so there is no need to re-parse it.
+	// The stack is only needed for this step, release it afterwards.
+	shared_ptr<yul::AssemblyStack> stack = move(compiledContract.yulIRStack);
+	util::PhaseTimer timer(m_phaseTimings, "yulOptimization", _contract.fullyQualifiedName());
+	// The IR was already optimized by IRGenerator::run, but the optimizer is not idempotent and
+	// the EVM code has always been generated from the IR optimized a second time. Dropping this
+	// call would change the bytecode of every contract compiled via IR.
+	stack->optimize();
+
+	// Includes the optimisation of the resulting assembly.
+	timer.next("evmCodeTransform");
 	string deployedName = IRNames::deployedObject(_contract);
 	solAssert(!deployedName.empty(), "");
-	tie(compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly) = stack.assembleEVMWithDeployed(deployedName);
+	tie(compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly) = stack->assembleEVMWithDeployed(deployedName);
+	timer.stop();
 	assemble(_contract, compiledContract.evmAssembly, compiledContract.evmRuntimeAssembly);
 }
 
@@ -1391,6 +1588,7 @@ void CompilerStack::generateEwasm(ContractDefinition const& _contract)
 	if (!compiledContract.ewasm.empty())
 		return;
 
+	util::PhaseTimer timer(m_phaseTimings, "ewasmGeneration", _contract.fullyQualifiedName());
 	// Re-parse the Yul IR in EVM dialect
 	yul::AssemblyStack stack(
 		m_evmVersion,
@@ -1513,6 +1711,15 @@ string CompilerStack::createMetadata(Contract const& _contract, bool _forIR) con
 		{
 			details["yulDetails"] = Json::objectValue;
 			details["yulDetails"]["stackAllocation"] = m_optimiserSettings.optimizeStackAllocation;
+			if (m_optimiserSettings.gasAwareInlining)
+				details["yulDetails"]["gasAwareInlining"] = true;
+			if (!m_optimiserSettings.functionExecutions.empty())
+			{
+				Json::Value& functionExecutions = details["yulDetails"]["functionExecutions"];
+				for (auto const& [objectName, functions]: m_optimiserSettings.functionExecutions)
+					for (auto const& [functionName, executions]: functions)
+						functionExecutions[objectName][functionName] = Json::UInt64(executions);
+			}
 			details["yulDetails"]["optimizerSteps"] = m_optimiserSettings.yulOptimiserSteps;
 		}
 
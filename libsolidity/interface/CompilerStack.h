@@ -25,12 +25,14 @@
 #pragma once
 
 #include <libsolidity/analysis/FunctionCallGraph.h>
+#include <libsolidity/codegen/MultiUseYulFunctionCache.h>
 #include <libsolidity/interface/ReadFile.h>
 #include <libsolidity/interface/ImportRemapper.h>
 #include <libsolidity/interface/OptimiserSettings.h>
 #include <libsolidity/interface/Version.h>
 #include <libsolidity/interface/DebugSettings.h>
 
+#include <libsolidity/formal/ModelCheckerQueryStats.h>
 #include <libsolidity/formal/ModelCheckerSettings.h>
 
 #include <libsmtutil/SolverInterface.h>
@@ -46,6 +48,7 @@
 #include <libsolutil/Common.h>
 #include <libsolutil/FixedHash.h>
 #include <libsolutil/LazyInit.h>
+#include <libsolutil/PhaseTimer.h>
 
 #include <json/json.h>
 
@@ -62,6 +65,14 @@ class CharStream;
 }
 
 
+namespace solidity::yul
+{
+class AssemblyStack;
+class OptimizedObjectCache;
+class OptimiserProfile;
+struct Object;
+}
+
 namespace solidity::evmasm
 {
 class Assembly;
@@ -165,6 +176,11 @@ public:
 		m_parserErrorRecovery = _wantErrorRecovery;
 	}
 
+	/// Sets the number of threads used to parse the sources concurrently.
+	/// Zero, the default, parses all sources on the calling thread.
+	/// Must be set before parsing.
+	void setParserThreads(size_t _threads = 0) { m_parserThreads = _threads; }
+
 	/// Sets the pipeline to go through the Yul IR or not.
 	/// Must be set before parsing.
 	void setViaIR(bool _viaIR);
@@ -195,6 +211,13 @@ public:
 	/// Enable experimental generation of Ewasm code. If enabled, IR is also generated.
 	void enableEwasmGeneration(bool _enable = true) { m_generateEwasm = _enable; }
 
+	/// Enable recording of the Yul optimizer steps applied to the IR of each contract.
+	/// Only has an effect if IR is generated.
+	void enableIROptimizerProfiling(bool _enable = true) { m_profileIROptimizer = _enable; }
+
+	/// Enable recording of the wall time, processor time and memory usage of the compilation phases.
+	void enablePhaseTimings(bool _enable = true) { m_phaseTimings.enable(_enable); }
+
 	/// @arg _metadataLiteralSources When true, store sources as literals in the contract metadata.
 	/// Must be set before parsing.
 	void useMetadataLiteralSources(bool _metadataLiteralSources);
@@ -256,6 +279,13 @@ public:
 	/// by calling @a addSMTLib2Response).
 	std::vector<std::string> const& unhandledSMTLib2Queries() const { return m_unhandledSMTLib2Queries; }
 
+	/// @returns statistics about the queries issued by the model checker.
+	/// Only filled if requested via the model checker settings.
+	std::vector<ModelCheckerQueryStats> const& modelCheckerQueryStats() const { return m_modelCheckerQueryStats; }
+
+	/// @returns the timings of all compilation phases run so far, if enabled.
+	std::vector<util::PhaseTiming> const& phaseTimings() const { return m_phaseTimings.timings(); }
+
 	/// @returns a list of the contract names in the sources.
 	std::vector<std::string> contractNames() const;
 
@@ -269,8 +299,13 @@ public:
 	std::string const& yulIR(std::string const& _contractName) const;
 
 	/// @returns the optimized IR representation of a contract.
+	/// Only available if IR generation was enabled.
 	std::string const& yulIROptimized(std::string const& _contractName) const;
 
+	/// @returns the steps the Yul optimizer applied to the IR of a contract, with their run time,
+	/// code size and changed functions, or null if IR optimizer profiling was not enabled.
+	Json::Value yulIROptimizerProfile(std::string const& _contractName) const;
+
 	/// @returns the Ewasm text representation of a contract.
 	std::string const& ewasm(std::string const& _contractName) const;
 
@@ -373,8 +408,16 @@ private:
 		std::shared_ptr<evmasm::Assembly> evmRuntimeAssembly;
 		evmasm::LinkerObject object; ///< Deployment object (includes the runtime sub-object).
 		evmasm::LinkerObject runtimeObject; ///< Runtime object.
-		std::string yulIR; ///< Experimental Yul IR code.
+		/// Experimental Yul IR code, in which the IR of created contracts is replaced by placeholders.
+		std::string yulIRWithPlaceholders;
+		util::LazyInit<std::string const> yulIR; ///< Experimental Yul IR code.
 		std::string yulIROptimized; ///< Optimized experimental Yul IR code.
+		/// Parsed and optimized Yul IR, kept until EVM code has been generated from it.
+		std::shared_ptr<yul::AssemblyStack> yulIRStack;
+		/// Yul optimizer steps applied to the IR, only recorded if profiling is enabled.
+		std::shared_ptr<yul::OptimiserProfile> yulIROptimizerProfile;
+		/// Parsed but unoptimized Yul IR, embedded into the IR of contracts creating this one.
+		std::shared_ptr<yul::Object const> yulIRObject;
 		std::string ewasm; ///< Experimental Ewasm text representation
 		evmasm::LinkerObject ewasmObject; ///< Experimental Ewasm code
 		util::LazyInit<std::string const> metadata; ///< The metadata json that will be hashed into the chain.
@@ -476,6 +519,9 @@ private:
 	/// This will generate the metadata and store it in the Contract object if it is not present yet.
 	std::string const& metadata(Contract const& _contract) const;
 
+	/// @returns the complete Yul IR code of @a _contract. It is only assembled on first request.
+	std::string const& yulIR(Contract const& _contract) const;
+
 	/// @returns the offset of the entry point of the given function into the list of assembly items
 	/// or zero if it is not found or does not exist.
 	size_t functionEntryPoint(
@@ -494,12 +540,23 @@ private:
 	bool m_generateEvmBytecode = true;
 	bool m_generateIR = false;
 	bool m_generateEwasm = false;
+	bool m_profileIROptimizer = false;
+	/// Yul objects optimized during IR generation, shared between all contracts while compiling.
+	std::shared_ptr<yul::OptimizedObjectCache> m_optimizedObjectCache;
+	/// Yul utility functions generated during IR generation, shared between all contracts while compiling.
+	std::shared_ptr<MultiUseYulFunctionCache> m_yulFunctionCache;
+	/// Yul utility functions that do not depend on the AST, shared between all compilations in
+	/// this process and by both code generators.
+	std::shared_ptr<MultiUseYulFunctionCache> m_astIndependentYulFunctionCache =
+		MultiUseYulFunctionCache::processWide();
 	std::map<std::string, util::h160> m_libraries;
 	ImportRemapper m_importRemapper;
 	std::map<std::string const, Source> m_sources;
 	// if imported, store AST-JSONS for each filename
 	std::map<std::string, Json::Value> m_sourceJsons;
 	std::vector<std::string> m_unhandledSMTLib2Queries;
+	std::vector<ModelCheckerQueryStats> m_modelCheckerQueryStats;
+	util::PhaseTimings m_phaseTimings;
 	std::map<util::h256, std::string> m_smtlib2Responses;
 	std::shared_ptr<GlobalContext> m_globalContext;
 	std::vector<Source const*> m_sourceOrder;
@@ -511,6 +568,7 @@ private:
 	MetadataHash m_metadataHash = MetadataHash::IPFS;
 	langutil::DebugInfoSelection m_debugInfoSelection = langutil::DebugInfoSelection::Default();
 	bool m_parserErrorRecovery = false;
+	size_t m_parserThreads = 0;
 	State m_stackState = Empty;
 	bool m_importedSources = false;
 	/// Whether or not there has been an error during processing.
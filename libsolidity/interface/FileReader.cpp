@@ -155,8 +155,7 @@ ReadCallback::Result FileReader::readFile(string const& _kind, string const& _so
 		// NOTE: we ignore the FileNotFound exception as we manually check above
 		auto contents = readFileAsString(candidates[0]);
 		solAssert(m_sourceCodes.count(_sourceUnitName) == 0, "");
-		m_sourceCodes[_sourceUnitName] = contents;
-		return ReadCallback::Result{true, contents};
+		return ReadCallback::Result{true, m_sourceCodes[_sourceUnitName] = std::move(contents)};
 	}
 	catch (util::Exception const& _exception)
 	{
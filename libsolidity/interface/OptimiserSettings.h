@@ -26,6 +26,7 @@
 #include <liblangutil/Exceptions.h>
 
 #include <cstddef>
+#include <map>
 #include <string>
 
 namespace solidity::frontend
@@ -116,9 +117,11 @@ struct OptimiserSettings
 			runCSE == _other.runCSE &&
 			runConstantOptimiser == _other.runConstantOptimiser &&
 			optimizeStackAllocation == _other.optimizeStackAllocation &&
+			gasAwareInlining == _other.gasAwareInlining &&
 			runYulOptimiser == _other.runYulOptimiser &&
 			yulOptimiserSteps == _other.yulOptimiserSteps &&
-			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment;
+			expectedExecutionsPerDeployment == _other.expectedExecutionsPerDeployment &&
+			functionExecutions == _other.functionExecutions;
 	}
 
 	/// Move literals to the right of commutative binary operators during code generation.
@@ -139,6 +142,9 @@ struct OptimiserSettings
 	bool runConstantOptimiser = false;
 	/// Perform more efficient stack allocation for variables during code generation from Yul to bytecode.
 	bool optimizeStackAllocation = false;
+	/// Let the Yul function inliner weigh the gas saved by avoiding function calls
+	/// (based on @a expectedExecutionsPerDeployment) against the costs of the additional code.
+	bool gasAwareInlining = false;
 	/// Yul optimiser with default settings. Will only run on certain parts of the code for now.
 	bool runYulOptimiser = false;
 	/// Sequence of optimisation steps to be performed by Yul optimiser.
@@ -149,6 +155,10 @@ struct OptimiserSettings
 	/// This specifies an estimate on how often each opcode in this assembly will be executed,
 	/// i.e. use a small value to optimise for size and a large value to optimise for runtime gas usage.
 	size_t expectedExecutionsPerDeployment = 200;
+	/// Recorded number of executions per deployment of Yul functions, by the name of the Yul object
+	/// and the function as they appear in the optimized code, e.g. measured by replaying transactions.
+	/// Takes precedence over @a expectedExecutionsPerDeployment for these functions.
+	std::map<std::string, std::map<std::string, size_t>> functionExecutions;
 };
 
 }
@@ -84,6 +84,31 @@ Json::Value formatFatalError(string const& _type, string const& _message)
 	return output;
 }
 
+/// @returns the fatal error to report for the exception that is currently being handled.
+Json::Value formatCurrentExceptionAsFatalError()
+{
+	try
+	{
+		throw;
+	}
+	catch (Json::LogicError const& _exception)
+	{
+		return formatFatalError("InternalCompilerError", string("JSON logic exception: ") + _exception.what());
+	}
+	catch (Json::RuntimeError const& _exception)
+	{
+		return formatFatalError("InternalCompilerError", string("JSON runtime exception: ") + _exception.what());
+	}
+	catch (util::Exception const& _exception)
+	{
+		return formatFatalError("InternalCompilerError", "Internal exception in StandardCompiler::compile: " + boost::diagnostic_information(_exception));
+	}
+	catch (...)
+	{
+		return formatFatalError("InternalCompilerError", "Internal exception in StandardCompiler::compile: " +  boost::current_exception_diagnostic_information());
+	}
+}
+
 Json::Value formatSourceLocation(SourceLocation const* location)
 {
 	if (!location || !location->sourceName)
@@ -96,6 +121,58 @@ Json::Value formatSourceLocation(SourceLocation const* location)
 	return sourceLocation;
 }
 
+Json::Value formatModelCheckerQueryStats(vector<ModelCheckerQueryStats> const& _stats)
+{
+	static map<smtutil::CheckResult, string> const resultStrings{
+		{smtutil::CheckResult::SATISFIABLE, "sat"},
+		{smtutil::CheckResult::UNSATISFIABLE, "unsat"},
+		{smtutil::CheckResult::UNKNOWN, "unknown"},
+		{smtutil::CheckResult::CONFLICTING, "conflicting"},
+		{smtutil::CheckResult::ERROR, "error"}
+	};
+
+	Json::Value queries{Json::arrayValue};
+	for (auto const& stats: _stats)
+	{
+		Json::Value query{Json::objectValue};
+		query["engine"] = stats.engine;
+		if (stats.solver)
+			query["solver"] = *stats.solver;
+		for (auto const& [name, type]: ModelCheckerTargets::targetStrings)
+			if (type == stats.target)
+				query["target"] = name;
+		query["sourceLocation"] = formatSourceLocation(&stats.location);
+		query["result"] = resultStrings.at(stats.result);
+		query["timeMicroseconds"] = Json::UInt64(stats.time.count());
+		if (stats.predicates)
+			query["predicates"] = Json::UInt64(*stats.predicates);
+		if (stats.rules)
+			query["rules"] = Json::UInt64(*stats.rules);
+		if (stats.smtlib2Size)
+			query["smtlib2Size"] = Json::UInt64(*stats.smtlib2Size);
+		queries.append(move(query));
+	}
+	return queries;
+}
+
+Json::Value formatPhaseTimings(vector<util::PhaseTiming> const& _timings)
+{
+	Json::Value phases{Json::arrayValue};
+	for (auto const& timing: _timings)
+	{
+		Json::Value phase{Json::objectValue};
+		phase["phase"] = timing.phase;
+		if (!timing.contract.empty())
+			phase["contract"] = timing.contract;
+		phase["wallTimeMicroseconds"] = Json::UInt64(timing.wallTime.count());
+		phase["cpuTimeMicroseconds"] = Json::UInt64(timing.cpuTime.count());
+		if (timing.peakMemoryIncrease)
+			phase["peakMemoryIncrease"] = Json::UInt64(*timing.peakMemoryIncrease);
+		phases.append(move(phase));
+	}
+	return phases;
+}
+
 Json::Value formatSecondarySourceLocation(SecondarySourceLocation const* _secondaryLocation)
 {
 	if (!_secondaryLocation)
@@ -180,7 +257,7 @@ bool hashMatchesContent(string const& _hash, string const& _content)
 
 bool isArtifactRequested(Json::Value const& _outputSelection, string const& _artifact, bool _wildcardMatchesExperimental)
 {
-	static set<string> experimental{"ir", "irOptimized", "wast", "ewasm", "ewasm.wast"};
+	static set<string> experimental{"ir", "irOptimized", "irOptimizerProfile", "wast", "ewasm", "ewasm.wast"};
 	for (auto const& selectedArtifactJson: _outputSelection)
 	{
 		string const& selectedArtifact = selectedArtifactJson.asString();
@@ -191,7 +268,7 @@ bool isArtifactRequested(Json::Value const& _outputSelection, string const& _art
 			return true;
 		else if (selectedArtifact == "*")
 		{
-			// "ir", "irOptimized", "wast" and "ewasm.wast" can only be matched by "*" if activated.
+			// "ir", "irOptimized", "irOptimizerProfile", "wast" and "ewasm.wast" can only be matched by "*" if activated.
 			if (experimental.count(_artifact) == 0 || _wildcardMatchesExperimental)
 				return true;
 		}
@@ -264,7 +341,7 @@ bool isBinaryRequested(Json::Value const& _outputSelection)
 	// This does not include "evm.methodIdentifiers" on purpose!
 	static vector<string> const outputsThatRequireBinaries = vector<string>{
 		"*",
-		"ir", "irOptimized",
+		"ir", "irOptimized", "irOptimizerProfile",
 		"wast", "wasm", "ewasm.wast", "ewasm.wasm",
 		"evm.gasEstimates", "evm.legacyAssembly", "evm.assembly"
 	} + evmObjectComponents("bytecode") + evmObjectComponents("deployedBytecode");
@@ -312,11 +389,27 @@ bool isEwasmRequested(Json::Value const& _outputSelection)
 	return false;
 }
 
+/// @returns true if the Yul optimizer profile of the IR was requested. Note that as an exception,
+/// '*' does not match "irOptimizerProfile"
+bool isIROptimizerProfileRequested(Json::Value const& _outputSelection)
+{
+	if (!_outputSelection.isObject())
+		return false;
+
+	for (auto const& fileRequests: _outputSelection)
+		for (auto const& requests: fileRequests)
+			for (auto const& request: requests)
+				if (request == "irOptimizerProfile")
+					return true;
+
+	return false;
+}
+
 /// @returns true if any Yul IR was requested. Note that as an exception, '*' does not
 /// yet match "ir" or "irOptimized"
 bool isIRRequested(Json::Value const& _outputSelection)
 {
-	if (isEwasmRequested(_outputSelection))
+	if (isEwasmRequested(_outputSelection) || isIROptimizerProfileRequested(_outputSelection))
 		return true;
 
 	if (!_outputSelection.isObject())
@@ -381,10 +474,11 @@ Json::Value formatImmutableReferences(map<u256, pair<string, vector<size_t>>> co
 	return ret;
 }
 
+/// The source map and the generated sources are only computed if they are requested.
 Json::Value collectEVMObject(
 	evmasm::LinkerObject const& _object,
-	string const* _sourceMap,
-	Json::Value _generatedSources,
+	function<string const*()> const& _sourceMap,
+	function<Json::Value()> const& _generatedSources,
 	bool _runtimeObject,
 	function<bool(string)> const& _artifactRequested
 )
@@ -395,7 +489,10 @@ Json::Value collectEVMObject(
 	if (_artifactRequested("opcodes"))
 		output["opcodes"] = evmasm::disassemble(_object.bytecode);
 	if (_artifactRequested("sourceMap"))
-		output["sourceMap"] = _sourceMap ? *_sourceMap : "";
+	{
+		string const* sourceMap = _sourceMap();
+		output["sourceMap"] = sourceMap ? *sourceMap : "";
+	}
 	if (_artifactRequested("functionDebugData"))
 		output["functionDebugData"] = StandardCompiler::formatFunctionDebugData(_object.functionDebugData);
 	if (_artifactRequested("linkReferences"))
@@ -403,7 +500,7 @@ Json::Value collectEVMObject(
 	if (_runtimeObject && _artifactRequested("immutableReferences"))
 		output["immutableReferences"] = formatImmutableReferences(_object.immutableReferences);
 	if (_artifactRequested("generatedSources"))
-		output["generatedSources"] = move(_generatedSources);
+		output["generatedSources"] = _generatedSources();
 	return output;
 }
 
@@ -445,7 +542,7 @@ std::optional<Json::Value> checkSettingsKeys(Json::Value const& _input)
 
 std::optional<Json::Value> checkModelCheckerSettingsKeys(Json::Value const& _input)
 {
-	static set<string> keys{"contracts", "divModNoSlacks", "engine", "invariants", "showUnproved", "solvers", "targets", "timeout"};
+	static set<string> keys{"contracts", "divModNoSlacks", "engine", "invariants", "showQueryStats", "showUnproved", "solvers", "targets", "timeout"};
 	return checkKeys(_input, keys, "modelChecker");
 }
 
@@ -499,6 +596,35 @@ std::optional<Json::Value> checkOptimizerDetailSteps(Json::Value const& _details
 	return {};
 }
 
+std::optional<Json::Value> checkOptimizerDetailFunctionExecutions(
+	Json::Value const& _details,
+	std::string const& _name,
+	map<string, map<string, size_t>>& _setting
+)
+{
+	if (!_details.isMember(_name))
+		return {};
+
+	string const errorMessage =
+		"\"settings.optimizer.details.yulDetails." + _name + "\" must be an object mapping Yul object names "
+		"to objects mapping function names to unsigned execution counts";
+	if (!_details[_name].isObject())
+		return formatFatalError("JSONError", errorMessage);
+	for (auto const& objectName: _details[_name].getMemberNames())
+	{
+		Json::Value const& functions = _details[_name][objectName];
+		if (!functions.isObject())
+			return formatFatalError("JSONError", errorMessage);
+		for (auto const& functionName: functions.getMemberNames())
+		{
+			if (!functions[functionName].isUInt64())
+				return formatFatalError("JSONError", errorMessage);
+			_setting[objectName][functionName] = static_cast<size_t>(functions[functionName].asUInt64());
+		}
+	}
+	return {};
+}
+
 std::optional<Json::Value> checkMetadataKeys(Json::Value const& _input)
 {
 	if (_input.isObject())
@@ -612,10 +738,14 @@ std::variant<OptimiserSettings, Json::Value> parseOptimizerSettings(Json::Value
 			if (!settings.runYulOptimiser)
 				return formatFatalError("JSONError", "\"Providing yulDetails requires Yul optimizer to be enabled.");
 
-			if (auto result = checkKeys(details["yulDetails"], {"stackAllocation", "optimizerSteps"}, "settings.optimizer.details.yulDetails"))
+			if (auto result = checkKeys(details["yulDetails"], {"stackAllocation", "gasAwareInlining", "functionExecutions", "optimizerSteps"}, "settings.optimizer.details.yulDetails"))
 				return *result;
 			if (auto error = checkOptimizerDetail(details["yulDetails"], "stackAllocation", settings.optimizeStackAllocation))
 				return *error;
+			if (auto error = checkOptimizerDetail(details["yulDetails"], "gasAwareInlining", settings.gasAwareInlining))
+				return *error;
+			if (auto error = checkOptimizerDetailFunctionExecutions(details["yulDetails"], "functionExecutions", settings.functionExecutions))
+				return *error;
 			if (auto error = checkOptimizerDetailSteps(details["yulDetails"], "optimizerSteps", settings.yulOptimiserSteps))
 				return *error;
 		}
@@ -797,7 +927,7 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 
 	if (settings.isMember("debug"))
 	{
-		if (auto result = checkKeys(settings["debug"], {"revertStrings", "debugInfo"}, "settings.debug"))
+		if (auto result = checkKeys(settings["debug"], {"revertStrings", "debugInfo", "timing"}, "settings.debug"))
 			return *result;
 
 		if (settings["debug"].isMember("revertStrings"))
@@ -839,6 +969,13 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 
 			ret.debugInfoSelection = debugInfoSelection.value();
 		}
+
+		if (settings["debug"].isMember("timing"))
+		{
+			if (!settings["debug"]["timing"].isBool())
+				return formatFatalError("JSONError", "settings.debug.timing must be a Boolean value.");
+			ret.phaseTimings = settings["debug"]["timing"].asBool();
+		}
 	}
 
 	if (settings.isMember("remappings") && !settings["remappings"].isArray())
@@ -1008,6 +1145,14 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 		ret.modelCheckerSettings.invariants = invariants;
 	}
 
+	if (modelCheckerSettings.isMember("showQueryStats"))
+	{
+		auto const& showQueryStats = modelCheckerSettings["showQueryStats"];
+		if (!showQueryStats.isBool())
+			return formatFatalError("JSONError", "settings.modelChecker.showQueryStats must be a Boolean value.");
+		ret.modelCheckerSettings.showQueryStats = showQueryStats.asBool();
+	}
+
 	if (modelCheckerSettings.isMember("showUnproved"))
 	{
 		auto const& showUnproved = modelCheckerSettings["showUnproved"];
@@ -1065,12 +1210,12 @@ std::variant<StandardCompiler::InputsAndSettings, Json::Value> StandardCompiler:
 	return { std::move(ret) };
 }
 
-Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inputsAndSettings)
+void StandardCompiler::compileSolidity(StandardCompiler::InputsAndSettings _inputsAndSettings, OutputCallback const& _output)
 {
 	CompilerStack compilerStack(m_readFile);
 
-	StringMap sourceList = std::move(_inputsAndSettings.sources);
-	compilerStack.setSources(sourceList);
+	set<string> const inputSourceNames = util::keys(_inputsAndSettings.sources);
+	compilerStack.setSources(std::move(_inputsAndSettings.sources));
 	for (auto const& smtLib2Response: _inputsAndSettings.smtLib2Responses)
 		compilerStack.addSMTLib2Response(smtLib2Response.first, smtLib2Response.second);
 	compilerStack.setViaIR(_inputsAndSettings.viaIR);
@@ -1090,6 +1235,8 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 	compilerStack.enableEvmBytecodeGeneration(isEvmBytecodeRequested(_inputsAndSettings.outputSelection));
 	compilerStack.enableIRGeneration(isIRRequested(_inputsAndSettings.outputSelection));
 	compilerStack.enableEwasmGeneration(isEwasmRequested(_inputsAndSettings.outputSelection));
+	compilerStack.enableIROptimizerProfiling(isIROptimizerProfileRequested(_inputsAndSettings.outputSelection));
+	compilerStack.enablePhaseTimings(_inputsAndSettings.phaseTimings);
 
 	Json::Value errors = std::move(_inputsAndSettings.errors);
 
@@ -1233,38 +1380,54 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 		((binariesRequested && !compilationSuccess) || !analysisPerformed) &&
 		(errors.empty() && _inputsAndSettings.stopAfter >= CompilerStack::State::AnalysisPerformed)
 	)
-		return formatFatalError("InternalCompilerError", "No error reported, but compilation failed.");
-
-	Json::Value output = Json::objectValue;
+	{
+		_output({"errors"}, formatFatalError("InternalCompilerError", "No error reported, but compilation failed.")["errors"]);
+		return;
+	}
 
-	if (errors.size() > 0)
-		output["errors"] = std::move(errors);
+	// The members of the output are passed on in the order in which they are printed,
+	// i.e. sorted by key, so that they can be written out as soon as they are generated.
 
 	if (!compilerStack.unhandledSMTLib2Queries().empty())
+	{
+		Json::Value smtlib2Queries{Json::objectValue};
 		for (string const& query: compilerStack.unhandledSMTLib2Queries())
-			output["auxiliaryInputRequested"]["smtlib2queries"]["0x" + util::keccak256(query).hex()] = query;
+			smtlib2Queries["0x" + util::keccak256(query).hex()] = query;
+		_output({"auxiliaryInputRequested", "smtlib2queries"}, std::move(smtlib2Queries));
+	}
 
 	bool const wildcardMatchesExperimental = false;
 
-	output["sources"] = Json::objectValue;
-	unsigned sourceIndex = 0;
-	if (compilerStack.state() >= CompilerStack::State::Parsed && (!compilerStack.hasError() || _inputsAndSettings.parserErrorRecovery))
-		for (string const& sourceName: compilerStack.sourceNames())
+	// Contracts are output grouped by source unit, which does not necessarily match
+	// the order of their fully qualified names.
+	auto const splitContractName = [](string const& _contractName) {
+		size_t colon = _contractName.rfind(':');
+		solAssert(colon != string::npos, "");
+		return make_pair(_contractName.substr(0, colon), _contractName.substr(colon + 1));
+	};
+	vector<string> contractNames = analysisPerformed ? compilerStack.contractNames() : vector<string>();
+	sort(contractNames.begin(), contractNames.end(), [&](string const& _a, string const& _b) {
+		return splitContractName(_a) < splitContractName(_b);
+	});
+
+	// The input sources are only needed for the assembly output, so they are not
+	// copied back out of the compiler stack unless it is requested.
+	optional<StringMap> sourceList;
+	auto const inputSources = [&]() -> StringMap const& {
+		if (!sourceList)
 		{
-			Json::Value sourceResult = Json::objectValue;
-			sourceResult["id"] = sourceIndex++;
-			if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "ast", wildcardMatchesExperimental))
-				sourceResult["ast"] = ASTJsonConverter(compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
-			output["sources"][sourceName] = sourceResult;
+			sourceList = StringMap{};
+			for (string const& sourceName: inputSourceNames)
+				(*sourceList)[sourceName] = compilerStack.charStream(sourceName).source();
 		}
+		return *sourceList;
+	};
 
-	Json::Value contractsOutput = Json::objectValue;
-	for (string const& contractName: analysisPerformed ? compilerStack.contractNames() : vector<string>())
+	for (string const& contractName: contractNames)
 	{
-		size_t colon = contractName.rfind(':');
-		solAssert(colon != string::npos, "");
-		string file = contractName.substr(0, colon);
-		string name = contractName.substr(colon + 1);
+		string file;
+		string name;
+		tie(file, name) = splitContractName(contractName);
 
 		// ABI, storage layout, documentation and metadata
 		Json::Value contractData(Json::objectValue);
@@ -1284,6 +1447,8 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 			contractData["ir"] = compilerStack.yulIR(contractName);
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimized", wildcardMatchesExperimental))
 			contractData["irOptimized"] = compilerStack.yulIROptimized(contractName);
+		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "irOptimizerProfile", wildcardMatchesExperimental))
+			contractData["irOptimizerProfile"] = compilerStack.yulIROptimizerProfile(contractName);
 
 		// Ewasm
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "ewasm.wast", wildcardMatchesExperimental))
@@ -1294,7 +1459,7 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 		// EVM
 		Json::Value evmData(Json::objectValue);
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.assembly", wildcardMatchesExperimental))
-			evmData["assembly"] = compilerStack.assemblyString(contractName, sourceList);
+			evmData["assembly"] = compilerStack.assemblyString(contractName, inputSources());
 		if (compilationSuccess && isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.legacyAssembly", wildcardMatchesExperimental))
 			evmData["legacyAssembly"] = compilerStack.assemblyJSON(contractName);
 		if (isArtifactRequested(_inputsAndSettings.outputSelection, file, name, "evm.methodIdentifiers", wildcardMatchesExperimental))
@@ -1311,8 +1476,8 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 		))
 			evmData["bytecode"] = collectEVMObject(
 				compilerStack.object(contractName),
-				compilerStack.sourceMapping(contractName),
-				compilerStack.generatedSources(contractName),
+				[&]() { return compilerStack.sourceMapping(contractName); },
+				[&]() { return compilerStack.generatedSources(contractName); },
 				false,
 				[&](string const& _element) { return isArtifactRequested(
 					_inputsAndSettings.outputSelection,
@@ -1332,8 +1497,8 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 		))
 			evmData["deployedBytecode"] = collectEVMObject(
 				compilerStack.runtimeObject(contractName),
-				compilerStack.runtimeSourceMapping(contractName),
-				compilerStack.generatedSources(contractName, true),
+				[&]() { return compilerStack.runtimeSourceMapping(contractName); },
+				[&]() { return compilerStack.generatedSources(contractName, true); },
 				true,
 				[&](string const& _element) { return isArtifactRequested(
 					_inputsAndSettings.outputSelection,
@@ -1348,16 +1513,32 @@ Json::Value StandardCompiler::compileSolidity(StandardCompiler::InputsAndSetting
 			contractData["evm"] = evmData;
 
 		if (!contractData.empty())
+			_output({"contracts", file, name}, std::move(contractData));
+	}
+
+	if (errors.size() > 0)
+		_output({"errors"}, std::move(errors));
+
+	if (_inputsAndSettings.modelCheckerSettings.showQueryStats)
+		_output({"modelChecker", "queryStats"}, formatModelCheckerQueryStats(compilerStack.modelCheckerQueryStats()));
+
+	bool sourcesWritten = false;
+	unsigned sourceIndex = 0;
+	if (compilerStack.state() >= CompilerStack::State::Parsed && (!compilerStack.hasError() || _inputsAndSettings.parserErrorRecovery))
+		for (string const& sourceName: compilerStack.sourceNames())
 		{
-			if (!contractsOutput.isMember(file))
-				contractsOutput[file] = Json::objectValue;
-			contractsOutput[file][name] = contractData;
+			Json::Value sourceResult = Json::objectValue;
+			sourceResult["id"] = sourceIndex++;
+			if (isArtifactRequested(_inputsAndSettings.outputSelection, sourceName, "", "ast", wildcardMatchesExperimental))
+				sourceResult["ast"] = ASTJsonConverter(compilerStack.state(), compilerStack.sourceIndices()).toJson(compilerStack.ast(sourceName));
+			_output({"sources", sourceName}, std::move(sourceResult));
+			sourcesWritten = true;
 		}
-	}
-	if (!contractsOutput.empty())
-		output["contracts"] = contractsOutput;
+	if (!sourcesWritten)
+		_output({"sources"}, Json::objectValue);
 
-	return output;
+	if (_inputsAndSettings.phaseTimings)
+		_output({"timing"}, formatPhaseTimings(compilerStack.phaseTimings()));
 }
 
 
@@ -1406,6 +1587,16 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 		));
 		return output;
 	}
+	if (_inputsAndSettings.phaseTimings)
+	{
+		output["errors"].append(formatError(
+			Error::Severity::Error,
+			"JSONError",
+			"general",
+			"Field \"settings.debug.timing\" cannot be used for Yul."
+		));
+		return output;
+	}
 
 	AssemblyStack stack(
 		_inputsAndSettings.evmVersion,
@@ -1483,8 +1674,8 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 				output["contracts"][sourceName][contractName]["evm"][objectKind] =
 					collectEVMObject(
 						*o.bytecode,
-						o.sourceMappings.get(),
-						Json::arrayValue,
+						[&]() { return o.sourceMappings.get(); },
+						[]() { return Json::Value(Json::arrayValue); },
 						false,
 						[&](string const& _element) { return isArtifactRequested(
 							_inputsAndSettings.outputSelection,
@@ -1505,38 +1696,43 @@ Json::Value StandardCompiler::compileYul(InputsAndSettings _inputsAndSettings)
 }
 
 
+void StandardCompiler::compile(Json::Value const& _input, OutputCallback const& _output)
+{
+	auto const outputMembers = [&](Json::Value const& _object) {
+		for (string const& key: _object.getMemberNames())
+			_output({key}, _object[key]);
+	};
+
+	auto parsed = parseInput(_input);
+	if (std::holds_alternative<Json::Value>(parsed))
+		return outputMembers(std::get<Json::Value>(parsed));
+	InputsAndSettings settings = std::get<InputsAndSettings>(std::move(parsed));
+	if (settings.language == "Solidity")
+		compileSolidity(std::move(settings), _output);
+	else if (settings.language == "Yul")
+		outputMembers(compileYul(std::move(settings)));
+	else
+		outputMembers(formatFatalError("JSONError", "Only \"Solidity\" or \"Yul\" is supported as a language."));
+}
+
 Json::Value StandardCompiler::compile(Json::Value const& _input) noexcept
 {
 	YulStringRepository::reset();
 
 	try
 	{
-		auto parsed = parseInput(_input);
-		if (std::holds_alternative<Json::Value>(parsed))
-			return std::get<Json::Value>(std::move(parsed));
-		InputsAndSettings settings = std::get<InputsAndSettings>(std::move(parsed));
-		if (settings.language == "Solidity")
-			return compileSolidity(std::move(settings));
-		else if (settings.language == "Yul")
-			return compileYul(std::move(settings));
-		else
-			return formatFatalError("JSONError", "Only \"Solidity\" or \"Yul\" is supported as a language.");
-	}
-	catch (Json::LogicError const& _exception)
-	{
-		return formatFatalError("InternalCompilerError", string("JSON logic exception: ") + _exception.what());
-	}
-	catch (Json::RuntimeError const& _exception)
-	{
-		return formatFatalError("InternalCompilerError", string("JSON runtime exception: ") + _exception.what());
-	}
-	catch (util::Exception const& _exception)
-	{
-		return formatFatalError("InternalCompilerError", "Internal exception in StandardCompiler::compile: " + boost::diagnostic_information(_exception));
+		Json::Value output = Json::objectValue;
+		compile(_input, [&](vector<string> const& _path, Json::Value _value) {
+			Json::Value* member = &output;
+			for (string const& key: _path)
+				member = &(*member)[key];
+			*member = std::move(_value);
+		});
+		return output;
 	}
 	catch (...)
 	{
-		return formatFatalError("InternalCompilerError", "Internal exception in StandardCompiler::compile: " +  boost::current_exception_diagnostic_information());
+		return formatCurrentExceptionAsFatalError();
 	}
 }
 
@@ -1554,9 +1750,7 @@ string StandardCompiler::compile(string const& _input) noexcept
 		return "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON.\"}]}";
 	}
 
-	// cout << "Input: " << input.toStyledString() << endl;
 	Json::Value output = compile(input);
-	// cout << "Output: " << output.toStyledString() << endl;
 
 	try
 	{
@@ -1568,6 +1762,77 @@ string StandardCompiler::compile(string const& _input) noexcept
 	}
 }
 
+void StandardCompiler::compile(string const& _input, ostream& _output) noexcept
+{
+	Json::Value input;
+	string errors;
+	try
+	{
+		if (!util::jsonParseStrict(_input, input, &errors))
+		{
+			_output << util::jsonPrint(formatFatalError("JSONError", errors), m_jsonPrintingFormat);
+			return;
+		}
+	}
+	catch (...)
+	{
+		_output << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error parsing input JSON.\"}]}";
+		return;
+	}
+
+	YulStringRepository::reset();
+
+	try
+	{
+		streamOutput(
+			[&](OutputCallback const& _outputCallback) { compile(input, _outputCallback); },
+			_output,
+			m_jsonPrintingFormat
+		);
+	}
+	catch (...)
+	{
+		_output << "{\"errors\":[{\"type\":\"JSONError\",\"component\":\"general\",\"severity\":\"error\",\"message\":\"Error writing output JSON.\"}]}";
+	}
+}
+
+void StandardCompiler::streamOutput(
+	function<void(OutputCallback const&)> const& _compile,
+	ostream& _output,
+	util::JsonFormat const& _format
+)
+{
+	util::JsonStreamWriter writer(_output, _format);
+	// The top-level "errors" member is only complete at the end, so it is held back and written
+	// last, out of the key order of the other members, which are written as they are produced.
+	// This also allows reporting an exception in it even if parts of the output have already
+	// been written. These parts stay in the output.
+	optional<Json::Value> errors;
+	try
+	{
+		_compile([&](vector<string> const& _path, Json::Value _value) {
+			if (_path.front() == "errors")
+			{
+				solAssert(_path.size() == 1 && !errors, "");
+				errors = std::move(_value);
+			}
+			else
+				writer.write(_path, _value);
+		});
+	}
+	catch (...)
+	{
+		if (!errors)
+			errors = Json::arrayValue;
+		for (Json::Value const& error: formatCurrentExceptionAsFatalError()["errors"])
+			errors->append(error);
+	}
+	if (errors)
+		writer.finish("errors", *errors);
+	else
+		writer.finish();
+}
+
 Json::Value StandardCompiler::formatFunctionDebugData(
 	map<string, evmasm::LinkerObject::FunctionDebugData> const& _debugInfo
 )
@@ -28,7 +28,9 @@
 
 #include <liblangutil/DebugInfoSelection.h>
 
+#include <functional>
 #include <optional>
+#include <ostream>
 #include <utility>
 #include <variant>
 
@@ -42,6 +44,10 @@ namespace solidity::frontend
 class StandardCompiler
 {
 public:
+	/// Receives the members of the output object at the given paths of keys, in the order
+	/// in which they are printed.
+	using OutputCallback = std::function<void(std::vector<std::string> const& _path, Json::Value _value)>;
+
 	/// Noncopyable.
 	StandardCompiler(StandardCompiler const&) = delete;
 	StandardCompiler& operator=(StandardCompiler const&) = delete;
@@ -62,11 +68,25 @@ public:
 	/// Parses input as JSON and peforms the above processing steps, returning a serialized JSON
 	/// output. Parsing errors are returned as regular errors.
 	std::string compile(std::string const& _input) noexcept;
+	/// Same as above, but writes the serialized output to @a _output artifact by artifact
+	/// as it is produced instead of building the whole output in memory first.
+	/// The top-level "errors" member is written last.
+	void compile(std::string const& _input, std::ostream& _output) noexcept;
 
 	static Json::Value formatFunctionDebugData(
 		std::map<std::string, evmasm::LinkerObject::FunctionDebugData> const& _debugInfo
 	);
 
+	/// Serializes the output members that @a _compile passes to its callback to @a _output
+	/// as soon as they are passed. Only the top-level "errors" member is held back and written
+	/// last, once @a _compile returns. If it throws instead, the members written so far stay
+	/// and "errors" is extended by a fatal error describing the exception.
+	static void streamOutput(
+		std::function<void(OutputCallback const&)> const& _compile,
+		std::ostream& _output,
+		util::JsonFormat const& _format
+	);
+
 private:
 	struct InputsAndSettings
 	{
@@ -81,6 +101,7 @@ private:
 		RevertStrings revertStrings = RevertStrings::Default;
 		OptimiserSettings optimiserSettings = OptimiserSettings::minimal();
 		std::optional<langutil::DebugInfoSelection> debugInfoSelection;
+		bool phaseTimings = false;
 		std::map<std::string, util::h160> libraries;
 		bool metadataLiteralSources = false;
 		CompilerStack::MetadataHash metadataHash = CompilerStack::MetadataHash::IPFS;
@@ -93,7 +114,10 @@ private:
 	/// it in condensed form or an error as a json object.
 	std::variant<InputsAndSettings, Json::Value> parseInput(Json::Value const& _input);
 
-	Json::Value compileSolidity(InputsAndSettings _inputsAndSettings);
+	/// Performs the compilation and passes the output to @a _output. Does not catch exceptions.
+	void compile(Json::Value const& _input, OutputCallback const& _output);
+
+	void compileSolidity(InputsAndSettings _inputsAndSettings, OutputCallback const& _output);
 	Json::Value compileYul(InputsAndSettings _inputsAndSettings);
 
 	ReadCallback::Callback m_readFile;
@@ -36,12 +36,21 @@
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string/predicate.hpp>
 #include <cctype>
+#include <mutex>
 #include <vector>
 #include <regex>
 
 using namespace std;
 using namespace solidity::langutil;
 
+namespace
+{
+/// The Yul parser and dialects rely on global state (the YulString repository and the
+/// dialect cache), so inline assembly of sources parsed concurrently is parsed one at a time.
+/// Only locked by parsers that were put into concurrent mode.
+mutex inlineAssemblyMutex;
+}
+
 namespace solidity::frontend
 {
 
@@ -1309,6 +1318,9 @@ ASTPointer<Statement> Parser::parseStatement(bool _allowUnchecked)
 ASTPointer<InlineAssembly> Parser::parseInlineAssembly(ASTPointer<ASTString> const& _docString)
 {
 	RecursionGuard recursionGuard(*this);
+	unique_lock<mutex> lock(inlineAssemblyMutex, defer_lock);
+	if (m_concurrent)
+		lock.lock();
 	SourceLocation location = currentLocation();
 
 	expectToken(Token::Assembly);
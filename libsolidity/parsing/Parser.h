@@ -41,14 +41,25 @@ public:
 	explicit Parser(
 		langutil::ErrorReporter& _errorReporter,
 		langutil::EVMVersion _evmVersion,
-		bool _errorRecovery = false
+		bool _errorRecovery = false,
+		int64_t _idOffset = 0
 	):
 		ParserBase(_errorReporter, _errorRecovery),
-		m_evmVersion(_evmVersion)
+		m_evmVersion(_evmVersion),
+		m_currentNodeID(_idOffset)
 	{}
 
 	ASTPointer<SourceUnit> parse(langutil::CharStream& _charStream);
 
+	/// @returns the ID of the last node created by this parser, or the ID offset it was
+	/// constructed with if it did not create any node.
+	int64_t lastNodeID() const { return m_currentNodeID; }
+
+	/// Makes the parser parse inline assembly only while no other parser that was put
+	/// into this mode does. Required if sources are parsed on multiple threads, because
+	/// the Yul parser and dialects rely on global state.
+	void setConcurrent() { m_concurrent = true; }
+
 private:
 	class ASTNodeFactory;
 
@@ -217,6 +228,8 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	/// Counter for the next AST node ID
 	int64_t m_currentNodeID = 0;
+	/// Whether inline assembly is parsed under a global lock, see @a setConcurrent.
+	bool m_concurrent = false;
 };
 
 }
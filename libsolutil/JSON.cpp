@@ -22,6 +22,7 @@
 
 #include <libsolutil/JSON.h>
 
+#include <libsolutil/Assertions.h>
 #include <libsolutil/CommonIO.h>
 
 #include <boost/algorithm/string/replace.hpp>
@@ -140,6 +141,109 @@ string jsonPrint(Json::Value const& _input, JsonFormat const& _format)
 	return result;
 }
 
+void JsonStreamWriter::write(vector<string> const& _path, Json::Value const& _value)
+{
+	assertThrow(!_path.empty(), Exception, "Empty JSON member path.");
+	assertThrow(!m_finished, Exception, "JSON stream already finished.");
+
+	openRootObject();
+
+	// Close all objects that are not on the path of the new member.
+	size_t commonDepth = 1;
+	while (
+		commonDepth < m_openObjects.size() &&
+		commonDepth < _path.size() &&
+		m_openObjects[commonDepth].key == _path[commonDepth - 1]
+	)
+		++commonDepth;
+	closeObjects(commonDepth);
+
+	// Open the missing objects along the path.
+	for (size_t i = commonDepth - 1; i + 1 < _path.size(); ++i)
+	{
+		writeKey(_path[i]);
+		writeIndentation(m_openObjects.size());
+		m_stream << "{";
+		m_openObjects.push_back({_path[i], "", true});
+	}
+
+	writeKey(_path.back());
+	writeValue(_value);
+}
+
+void JsonStreamWriter::finish()
+{
+	assertThrow(!m_finished, Exception, "JSON stream already finished.");
+	if (m_openObjects.empty())
+		m_stream << "{}";
+	closeObjects(0);
+	m_finished = true;
+}
+
+void JsonStreamWriter::finish(string const& _key, Json::Value const& _value)
+{
+	assertThrow(!m_finished, Exception, "JSON stream already finished.");
+
+	openRootObject();
+	closeObjects(1);
+	writeKey(_key, false);
+	writeValue(_value);
+	finish();
+}
+
+void JsonStreamWriter::openRootObject()
+{
+	if (m_openObjects.empty())
+	{
+		m_stream << "{";
+		m_openObjects.emplace_back();
+	}
+}
+
+void JsonStreamWriter::closeObjects(size_t _depth)
+{
+	while (m_openObjects.size() > _depth)
+	{
+		m_openObjects.pop_back();
+		writeIndentation(m_openObjects.size());
+		m_stream << "}";
+	}
+}
+
+void JsonStreamWriter::writeKey(string const& _key, bool _ordered)
+{
+	Level& level = m_openObjects.back();
+	assertThrow(!_ordered || level.empty || level.lastMember < _key, Exception, "JSON members not written in order.");
+	if (!level.empty)
+		m_stream << ",";
+	level.lastMember = _key;
+	level.empty = false;
+
+	writeIndentation(m_openObjects.size());
+	m_stream << jsonPrint(Json::Value(_key), m_format) << ":";
+}
+
+void JsonStreamWriter::writeValue(Json::Value const& _value)
+{
+	string value = jsonPrint(_value, m_format);
+	if (m_format.format == JsonFormat::Pretty && value.find('\n') != string::npos)
+	{
+		// Multi-line values start on a new line and are indented relative to the
+		// enclosing object.
+		string indentation(m_openObjects.size() * m_format.indent, ' ');
+		boost::replace_all(value, "\n", "\n" + indentation);
+		m_stream << "\n" << indentation << value;
+	}
+	else
+		m_stream << (m_format.format == JsonFormat::Pretty ? " " : "") << value;
+}
+
+void JsonStreamWriter::writeIndentation(size_t _depth)
+{
+	if (m_format.format == JsonFormat::Pretty)
+		m_stream << "\n" << string(_depth * m_format.indent, ' ');
+}
+
 bool jsonParseStrict(string const& _input, Json::Value& _json, string* _errs /* = nullptr */)
 {
 	static StrictModeCharReaderBuilder readerBuilder;
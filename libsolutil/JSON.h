@@ -25,7 +25,9 @@
 
 #include <json/json.h>
 
+#include <ostream>
 #include <string>
+#include <vector>
 
 namespace solidity::util
 {
@@ -60,6 +62,55 @@ std::string jsonCompactPrint(Json::Value const& _input);
 /// Serialise the JSON object (@a _input) using specified format (@a _format)
 std::string jsonPrint(Json::Value const& _input, JsonFormat const& _format);
 
+/// Writes a JSON object to a stream member by member, producing the same text as
+/// jsonPrint() would produce for the complete object. This avoids having to keep the
+/// whole object (and its serialisation) in memory at once.
+///
+/// Members are addressed by their path of keys relative to the root object. Objects along
+/// the path are opened and closed as needed. Since jsonPrint() sorts object members by key,
+/// the members have to be written in that order as well. Only a final top-level member,
+/// written by the @a finish overload, may break that order.
+class JsonStreamWriter
+{
+public:
+	JsonStreamWriter(std::ostream& _stream, JsonFormat const& _format):
+		m_stream(_stream), m_format(_format) {}
+
+	/// Writes @a _value as the member at @a _path, which must not be empty.
+	void write(std::vector<std::string> const& _path, Json::Value const& _value);
+	/// Closes all open objects. No members can be written afterwards.
+	void finish();
+	/// Writes @a _value as the top-level member @a _key, which must not have been written
+	/// before, even if it sorts before members already written, and closes all open objects.
+	void finish(std::string const& _key, Json::Value const& _value);
+
+private:
+	struct Level
+	{
+		/// Key of the member of the enclosing object that this object is the value of.
+		std::string key;
+		/// Key of the last member written to this object, empty if there is none.
+		std::string lastMember;
+		bool empty = true;
+	};
+
+	/// Opens the root object unless it is already open.
+	void openRootObject();
+	/// Closes open objects until only @a _depth of them remain open.
+	void closeObjects(size_t _depth);
+	/// Writes @a _key into the innermost open object, asserting that it sorts after the
+	/// previous member if @a _ordered is set.
+	void writeKey(std::string const& _key, bool _ordered = true);
+	void writeValue(Json::Value const& _value);
+	void writeIndentation(size_t _depth);
+
+	std::ostream& m_stream;
+	JsonFormat m_format;
+	/// Objects that are currently open, starting with the root object.
+	std::vector<Level> m_openObjects;
+	bool m_finished = false;
+};
+
 /// Parse a JSON string (@a _input) with enabled strict-mode and writes resulting JSON object to (@a _json)
 /// \param _input JSON input string
 /// \param _json [out] resulting JSON object
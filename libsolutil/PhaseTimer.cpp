@@ -0,0 +1,81 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/PhaseTimer.h>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#include <algorithm>
+
+using namespace std;
+using namespace solidity::util;
+
+optional<size_t> solidity::util::processPeakMemory()
+{
+#if defined(__linux__) || defined(__APPLE__)
+	rusage usage{};
+	if (getrusage(RUSAGE_SELF, &usage) == 0)
+#if defined(__APPLE__)
+		return static_cast<size_t>(usage.ru_maxrss);
+#else
+		// Linux reports kilobytes.
+		return static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+	return nullopt;
+}
+
+PhaseTimer::PhaseTimer(PhaseTimings& _timings, string _phase, string _contract):
+	m_timings(_timings),
+	m_contract(move(_contract))
+{
+	next(move(_phase));
+}
+
+void PhaseTimer::next(string _phase)
+{
+	stop();
+	if (!m_timings.enabled())
+		return;
+	m_phase = move(_phase);
+	m_peakMemoryStart = processPeakMemory();
+	m_cpuStart = clock();
+	m_wallStart = chrono::steady_clock::now();
+}
+
+void PhaseTimer::stop()
+{
+	if (!m_phase)
+		return;
+
+	auto wallTime = chrono::steady_clock::now() - m_wallStart;
+	clock_t cpuTime = clock() - m_cpuStart;
+	PhaseTiming timing;
+	timing.phase = move(*m_phase);
+	timing.contract = m_contract;
+	timing.wallTime = chrono::duration_cast<chrono::microseconds>(wallTime);
+	timing.cpuTime = chrono::microseconds(static_cast<int64_t>(
+		static_cast<double>(cpuTime) * 1e6 / static_cast<double>(CLOCKS_PER_SEC)
+	));
+	if (optional<size_t> peakMemory = processPeakMemory(); peakMemory && m_peakMemoryStart)
+		timing.peakMemoryIncrease = *peakMemory - min(*peakMemory, *m_peakMemoryStart);
+	m_timings.add(move(timing));
+	m_phase.reset();
+}
@@ -0,0 +1,99 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Measurement of the wall time, processor time and memory usage of compiler phases.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <ctime>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace solidity::util
+{
+
+struct PhaseTiming
+{
+	std::string phase;
+	/// Fully qualified name of the contract the phase ran for, empty for phases covering all sources.
+	std::string contract;
+	std::chrono::microseconds wallTime{};
+	/// Processor time of the whole process, including helper threads.
+	std::chrono::microseconds cpuTime{};
+	/// Number of bytes by which the peak resident set size of the process grew during the phase,
+	/// if the platform provides it. Zero if the phase did not use more memory than the process
+	/// already had at some point before.
+	std::optional<size_t> peakMemoryIncrease;
+};
+
+/// @returns the peak resident set size of the process since its start in bytes,
+/// if the platform provides it.
+std::optional<size_t> processPeakMemory();
+
+/**
+ * Collection of phase timings, which are only recorded if enabled.
+ */
+class PhaseTimings
+{
+public:
+	void enable(bool _enable = true) { m_enabled = _enable; }
+	bool enabled() const { return m_enabled; }
+
+	void add(PhaseTiming _timing) { m_timings.emplace_back(std::move(_timing)); }
+	void clear() { m_timings.clear(); }
+	/// @returns all recorded timings in the order in which the phases finished.
+	std::vector<PhaseTiming> const& timings() const { return m_timings; }
+
+private:
+	bool m_enabled = false;
+	std::vector<PhaseTiming> m_timings;
+};
+
+/**
+ * Measures a phase from construction until destruction or until the next phase is started
+ * and records it in the given timings. Does nothing if the timings are not enabled.
+ * Timers must not be nested, since the processor time and memory usage are process-wide.
+ */
+class PhaseTimer
+{
+public:
+	PhaseTimer(PhaseTimings& _timings, std::string _phase, std::string _contract = {});
+	~PhaseTimer() { stop(); }
+
+	PhaseTimer(PhaseTimer const&) = delete;
+	PhaseTimer& operator=(PhaseTimer const&) = delete;
+
+	/// Finishes the current phase, if any, and starts measuring @a _phase.
+	void next(std::string _phase);
+	/// Finishes the current phase, if any.
+	void stop();
+
+private:
+	PhaseTimings& m_timings;
+	std::string m_contract;
+	std::optional<std::string> m_phase;
+	std::chrono::steady_clock::time_point m_wallStart;
+	std::clock_t m_cpuStart = 0;
+	std::optional<size_t> m_peakMemoryStart;
+};
+
+}
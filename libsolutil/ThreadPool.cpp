@@ -0,0 +1,127 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libsolutil/ThreadPool.h>
+
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif
+
+#include <system_error>
+#include <thread>
+
+using namespace std;
+using namespace solidity::util;
+
+struct ThreadPool::Worker
+{
+#if defined(_WIN32)
+	/// Threads on Windows get the stack size of the executable (see ``/STACK``) by default.
+	thread handle;
+#else
+	pthread_t handle;
+#endif
+};
+
+ThreadPool::ThreadPool(size_t _threads, size_t _stackSize)
+{
+	m_workers.reserve(_threads);
+	for (size_t i = 0; i < _threads; ++i)
+	{
+		auto worker = make_unique<Worker>();
+#if defined(_WIN32)
+		(void)_stackSize;
+		worker->handle = thread([this]() { work(); });
+#else
+		pthread_attr_t attributes;
+		pthread_attr_init(&attributes);
+		int error = pthread_attr_setstacksize(&attributes, _stackSize);
+		if (!error)
+			error = pthread_create(
+				&worker->handle,
+				&attributes,
+				[](void* _pool) -> void* { static_cast<ThreadPool*>(_pool)->work(); return nullptr; },
+				this
+			);
+		pthread_attr_destroy(&attributes);
+		if (error)
+		{
+			stop();
+			throw system_error(error, generic_category(), "Could not start worker thread");
+		}
+#endif
+		m_workers.emplace_back(move(worker));
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	stop();
+}
+
+size_t ThreadPool::defaultThreadCount()
+{
+#ifdef __EMSCRIPTEN__
+	return 0;
+#else
+	unsigned cores = thread::hardware_concurrency();
+	return cores > 1 ? cores : 0;
+#endif
+}
+
+void ThreadPool::enqueue(function<void()> _job)
+{
+	{
+		lock_guard<mutex> lock(m_mutex);
+		m_jobs.emplace_back(move(_job));
+	}
+	m_condition.notify_one();
+}
+
+void ThreadPool::work()
+{
+	while (true)
+	{
+		function<void()> job;
+		{
+			unique_lock<mutex> lock(m_mutex);
+			m_condition.wait(lock, [this]() { return m_stopping || !m_jobs.empty(); });
+			if (m_jobs.empty())
+				return;
+			job = move(m_jobs.front());
+			m_jobs.pop_front();
+		}
+		job();
+	}
+}
+
+void ThreadPool::stop()
+{
+	{
+		lock_guard<mutex> lock(m_mutex);
+		m_stopping = true;
+	}
+	m_condition.notify_all();
+	for (unique_ptr<Worker>& worker: m_workers)
+#if defined(_WIN32)
+		worker->handle.join();
+#else
+		pthread_join(worker->handle, nullptr);
+#endif
+	m_workers.clear();
+}
@@ -0,0 +1,91 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Simple fixed-size thread pool.
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace solidity::util
+{
+
+/**
+ * Fixed-size pool of worker threads that execute tasks in the order they were submitted.
+ * A pool without threads executes every task synchronously inside @a submit.
+ * Exceptions thrown by a task are stored in the future returned by @a submit.
+ * The destructor waits for all tasks that were already submitted.
+ */
+class ThreadPool
+{
+public:
+	/// Stack size of the worker threads. The parser and the code generators recurse deeply,
+	/// so the workers get the stack size the solc executable requests for its main thread
+	/// instead of the platform default for secondary threads, which is only 512 KiB on macOS.
+	static constexpr size_t defaultStackSize = 16 * 1024 * 1024;
+
+	explicit ThreadPool(size_t _threads, size_t _stackSize = defaultStackSize);
+	~ThreadPool();
+
+	ThreadPool(ThreadPool const&) = delete;
+	ThreadPool& operator=(ThreadPool const&) = delete;
+
+	template <typename Task>
+	std::future<std::invoke_result_t<Task>> submit(Task&& _task)
+	{
+		using Result = std::invoke_result_t<Task>;
+		auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Task>(_task));
+		std::future<Result> result = task->get_future();
+		if (m_workers.empty())
+			(*task)();
+		else
+			enqueue([task]() { (*task)(); });
+		return result;
+	}
+
+	/// @returns the number of worker threads.
+	size_t size() const { return m_workers.size(); }
+
+	/// @returns the number of threads to use by default, which is zero
+	/// if the platform does not support threads or has only a single core.
+	static size_t defaultThreadCount();
+
+private:
+	struct Worker;
+
+	void enqueue(std::function<void()> _job);
+	void work();
+	/// Lets the workers finish the submitted tasks and joins them.
+	void stop();
+
+	std::mutex m_mutex;
+	std::condition_variable m_condition;
+	std::deque<std::function<void()>> m_jobs;
+	bool m_stopping = false;
+	std::vector<std::unique_ptr<Worker>> m_workers;
+};
+
+}
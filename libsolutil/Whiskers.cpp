@@ -26,13 +26,249 @@
 
 #include <libsolutil/Assertions.h>
 
-#include <regex>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <string_view>
+#include <unordered_map>
 
 using namespace std;
 using namespace solidity::util;
 
+namespace
+{
+
+bool isParameterCharacter(char _c)
+{
+	return
+		('a' <= _c && _c <= 'z') ||
+		('A' <= _c && _c <= 'Z') ||
+		('0' <= _c && _c <= '9') ||
+		_c == '_' || _c == '$' || _c == '-';
+}
+
+}
+
+struct Whiskers::Template
+{
+	struct Element;
+	using Elements = vector<Element>;
+
+	struct Element
+	{
+		enum class Kind { Text, Parameter, List, Condition };
+		Kind kind = Kind::Text;
+		/// The literal text or the name of the parameter, list or condition
+		/// (including the "+" of conditional value parameters).
+		string_view text;
+		/// The list body or the part used if the condition is true.
+		Elements body;
+		/// The part used if the condition is false.
+		Elements elseBody;
+		/// The source of @a body and @a elseBody, used in error messages.
+		string_view bodySource;
+		string_view elseBodySource;
+	};
+
+	explicit Template(string _text): text(move(_text))
+	{
+		elements = parseElements(text);
+		for (size_t pos = text.find('<'); pos != string::npos; pos = text.find('<', pos + 1))
+		{
+			size_t end = pos + 1;
+			if (end < text.size() && (text[end] == '#' || text[end] == '?' || text[end] == '/' || text[end] == '!'))
+				++end;
+			if (end < text.size() && text[end] == '+')
+				++end;
+			size_t nameStart = end;
+			while (end < text.size() && isParameterCharacter(text[end]))
+				++end;
+			if (end > nameStart && end < text.size() && text[end] == '>')
+				tags.emplace(text.substr(pos, end + 1 - pos));
+		}
+	}
+
+	/// Renders parsed templates. Inside a list body, @a listElement holds the parameters
+	/// of the current element and list parameters are not available.
+	struct Renderer
+	{
+		Whiskers::StringMap const& parameters;
+		map<string, bool> const& conditions;
+		Whiskers::StringListMap const* listParameters;
+		Whiskers::StringMap const* listElement;
+		string& output;
+
+		string const* findParameter(string const& _name) const
+		{
+			if (listElement)
+				if (auto it = listElement->find(_name); it != listElement->end())
+					return &it->second;
+			if (auto it = parameters.find(_name); it != parameters.end())
+				return &it->second;
+			return nullptr;
+		}
+
+		void render(vector<Element> const& _elements, string_view _source) const
+		{
+			for (Element const& element: _elements)
+				switch (element.kind)
+				{
+				case Element::Kind::Text:
+					output += element.text;
+					break;
+				case Element::Kind::Parameter:
+				{
+					string const name(element.text);
+					string const* value = findParameter(name);
+					assertThrow(
+						value,
+						WhiskersError,
+						"Value for tag " + name + " not provided.\n" +
+						"Template:\n" +
+						string(_source)
+					);
+					output += *value;
+					break;
+				}
+				case Element::Kind::List:
+				{
+					string const name(element.text);
+					assertThrow(
+						listParameters && listParameters->count(name),
+						WhiskersError, "List parameter " + name + " not set."
+					);
+					for (Whiskers::StringMap const& elementParameters: listParameters->at(name))
+					{
+						for (auto const& parameter: elementParameters)
+							assertThrow(
+								!parameters.count(parameter.first),
+								WhiskersError,
+								"Parameter collision"
+							);
+						Renderer{parameters, conditions, nullptr, &elementParameters, output}.render(
+							element.body,
+							element.bodySource
+						);
+					}
+					break;
+				}
+				case Element::Kind::Condition:
+				{
+					string const name(element.text);
+					bool conditionValue = false;
+					if (name[0] == '+')
+					{
+						string tag = name.substr(1);
+
+						if (string const* value = findParameter(tag))
+							conditionValue = !value->empty();
+						else if (listParameters && listParameters->count(tag))
+							conditionValue = !listParameters->at(tag).empty();
+						else
+							assertThrow(false, WhiskersError, "Tag " + tag + " used as condition but was not set.");
+					}
+					else
+					{
+						assertThrow(
+							conditions.count(name),
+							WhiskersError, "Condition parameter " + name + " not set."
+						);
+						conditionValue = conditions.at(name);
+					}
+					if (conditionValue)
+						render(element.body, element.bodySource);
+					else
+						render(element.elseBody, element.elseBodySource);
+					break;
+				}
+				}
+		}
+	};
+
+	/// Splits @a _source into text and tags. Lists and conditions are only recognized
+	/// if they are closed, the body ends at the first matching closing tag.
+	static Elements parseElements(string_view _source);
+	static optional<pair<Element, size_t>> parseElement(string_view _source, size_t _position);
+
+	string const text;
+	Elements elements;
+	/// All tags like "<name>", "<#name>", "</name>" in the template.
+	set<string, less<>> tags;
+};
+
+Whiskers::Template::Elements Whiskers::Template::parseElements(string_view _source)
+{
+	Elements elements;
+	size_t textStart = 0;
+	for (size_t pos = _source.find('<'); pos != string_view::npos; pos = _source.find('<', pos))
+	{
+		optional<pair<Element, size_t>> element = parseElement(_source, pos);
+		if (!element)
+		{
+			++pos;
+			continue;
+		}
+		if (pos > textStart)
+			elements.push_back({Element::Kind::Text, _source.substr(textStart, pos - textStart), {}, {}, {}, {}});
+		elements.emplace_back(move(element->first));
+		pos = textStart = element->second;
+	}
+	if (textStart < _source.size())
+		elements.push_back({Element::Kind::Text, _source.substr(textStart), {}, {}, {}, {}});
+	return elements;
+}
+
+optional<pair<Whiskers::Template::Element, size_t>> Whiskers::Template::parseElement(string_view _source, size_t _position)
+{
+	size_t pos = _position + 1;
+	char marker = pos < _source.size() ? _source[pos] : '\0';
+	if (marker == '#' || marker == '?')
+		++pos;
+	size_t const nameStart = pos;
+	if (marker == '?' && pos < _source.size() && _source[pos] == '+')
+		++pos;
+	size_t const nameCharactersStart = pos;
+	while (pos < _source.size() && isParameterCharacter(_source[pos]))
+		++pos;
+	if (pos == nameCharactersStart || pos == _source.size() || _source[pos] != '>')
+		return nullopt;
+
+	Element element;
+	element.text = _source.substr(nameStart, pos - nameStart);
+	size_t const contentStart = pos + 1;
+	if (marker != '#' && marker != '?')
+	{
+		element.kind = Element::Kind::Parameter;
+		return {{move(element), contentStart}};
+	}
+
+	string const closingTag = "</" + string(element.text) + ">";
+	size_t const closingTagPosition = _source.find(closingTag, contentStart);
+	if (closingTagPosition == string_view::npos)
+		return nullopt;
+	size_t bodyEnd = closingTagPosition;
+	if (marker == '?')
+	{
+		element.kind = Element::Kind::Condition;
+		string const elseTag = "<!" + string(element.text) + ">";
+		size_t const elseTagPosition = _source.find(elseTag, contentStart);
+		if (elseTagPosition < closingTagPosition)
+		{
+			bodyEnd = elseTagPosition;
+			size_t const elseStart = elseTagPosition + elseTag.size();
+			element.elseBodySource = _source.substr(elseStart, closingTagPosition - elseStart);
+			element.elseBody = parseElements(element.elseBodySource);
+		}
+	}
+	else
+		element.kind = Element::Kind::List;
+	element.bodySource = _source.substr(contentStart, bodyEnd - contentStart);
+	element.body = parseElements(element.bodySource);
+	return {{move(element), closingTagPosition + closingTag.size()}};
+}
+
 Whiskers::Whiskers(string _template):
-	m_template(move(_template))
+	m_template(parse(move(_template)))
 {
 }
 
@@ -71,14 +307,26 @@ Whiskers& Whiskers::operator()(
 
 string Whiskers::render() const
 {
-	return replace(m_template, m_parameters, m_conditions, m_listParameters);
+	size_t size = m_template->text.size();
+	for (auto const& parameter: m_parameters)
+		size += parameter.second.size();
+	string result;
+	result.reserve(size);
+	Template::Renderer{m_parameters, m_conditions, &m_listParameters, nullptr, result}.render(
+		m_template->elements,
+		m_template->text
+	);
+	return result;
 }
 
 void Whiskers::checkParameterValid(string const& _parameter) const
 {
-	static regex validParam("^" + paramRegex() + "$");
+	bool valid = !_parameter.empty();
+	for (char c: _parameter)
+		if (!isParameterCharacter(c))
+			valid = false;
 	assertThrow(
-		regex_match(_parameter, validParam),
+		valid,
 		WhiskersError,
 		"Parameter" + _parameter + " contains invalid characters."
 	);
@@ -109,124 +357,25 @@ void Whiskers::checkTemplateContainsTags(string const& _parameter, vector<string
 	{
 		string tag{"<" + prefix + _parameter + ">"};
 		assertThrow(
-			m_template.find(tag) != string::npos,
+			m_template->tags.count(tag),
 			WhiskersError,
-			"Tag '" + tag + "' not found in template:\n" + m_template
+			"Tag '" + tag + "' not found in template:\n" + m_template->text
 		);
 	}
 }
 
-namespace
-{
-template<class ReplaceCallback>
-string regex_replace(
-	string const& _source,
-	regex const& _pattern,
-	ReplaceCallback _replace,
-	regex_constants::match_flag_type _flags = regex_constants::match_default
-)
-{
-	sregex_iterator curMatch(_source.begin(), _source.end(), _pattern, _flags);
-	sregex_iterator matchEnd;
-	string::const_iterator lastMatchedPos(_source.cbegin());
-	string result;
-	while (curMatch != matchEnd)
-	{
-		result.append(curMatch->prefix().first, curMatch->prefix().second);
-		result.append(_replace(*curMatch));
-		lastMatchedPos = (*curMatch)[0].second;
-		++curMatch;
-	}
-	result.append(lastMatchedPos, _source.cend());
-	return result;
-}
-}
-
-string Whiskers::replace(
-	string const& _template,
-	StringMap const& _parameters,
-	map<string, bool> const& _conditions,
-	map<string, vector<StringMap>> const& _listParameters
-)
+shared_ptr<Whiskers::Template const> Whiskers::parse(string _template)
 {
-	static regex listOrTag(
-		"<(" + paramRegex() + ")>|"
-		"<#(" + paramRegex() + ")>((?:.|\\r|\\n)*?)</\\2>|"
-		"<\\?(\\+?" + paramRegex() + ")>((?:.|\\r|\\n)*?)(<!\\4>((?:.|\\r|\\n)*?))?</\\4>"
-	);
-	return regex_replace(_template, listOrTag, [&](match_results<string::const_iterator> _match) -> string
-	{
-		string tagName(_match[1]);
-		string listName(_match[2]);
-		string conditionName(_match[4]);
-		if (!tagName.empty())
-		{
-			assertThrow(
-				_parameters.count(tagName),
-				WhiskersError,
-				"Value for tag " + tagName + " not provided.\n" +
-				"Template:\n" +
-				_template
-			);
-			return _parameters.at(tagName);
-		}
-		else if (!listName.empty())
-		{
-			string templ(_match[3]);
-			assertThrow(
-				_listParameters.count(listName),
-				WhiskersError, "List parameter " + listName + " not set."
-			);
-			string replacement;
-			for (auto const& parameters: _listParameters.at(listName))
-				replacement += replace(templ, joinMaps(_parameters, parameters), _conditions);
-			return replacement;
-		}
-		else
-		{
-			assertThrow(!conditionName.empty(), WhiskersError, "");
-			bool conditionValue = false;
-			if (conditionName[0] == '+')
-			{
-				string tag = conditionName.substr(1);
-
-				if (_parameters.count(tag))
-					conditionValue = !_parameters.at(tag).empty();
-				else if (_listParameters.count(tag))
-					conditionValue = !_listParameters.at(tag).empty();
-				else
-					assertThrow(false, WhiskersError, "Tag " + tag + " used as condition but was not set.");
-			}
-			else
-			{
-				assertThrow(
-					_conditions.count(conditionName),
-					WhiskersError, "Condition parameter " + conditionName + " not set."
-				);
-				conditionValue = _conditions.at(conditionName);
-			}
-			return replace(
-				conditionValue ? _match[5] : _match[7],
-				_parameters,
-				_conditions,
-				_listParameters
-			);
-		}
-	});
-}
+	// Templates are mostly string literals, but limit the cache size in case of generated ones.
+	static size_t constexpr maxCachedTemplates = 4096;
+	static mutex cacheMutex;
+	static unordered_map<string_view, shared_ptr<Template const>> cache;
 
-Whiskers::StringMap Whiskers::joinMaps(
-	Whiskers::StringMap const& _a,
-	Whiskers::StringMap const& _b
-)
-{
-	Whiskers::StringMap ret = _a;
-	for (auto const& x: _b)
-		assertThrow(
-			ret.insert(x).second,
-			WhiskersError,
-			"Parameter collision"
-		);
-	return ret;
+	lock_guard<mutex> lock(cacheMutex);
+	if (auto it = cache.find(_template); it != cache.end())
+		return it->second;
+	auto parsedTemplate = make_shared<Template const>(move(_template));
+	if (cache.size() < maxCachedTemplates)
+		cache.emplace(parsedTemplate->text, parsedTemplate);
+	return parsedTemplate;
 }
-
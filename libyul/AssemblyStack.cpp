@@ -63,6 +63,23 @@ Dialect const& languageToDialect(AssemblyStack::Language _language, EVMVersion _
 	return Dialect::yulDeprecated();
 }
 
+void replaceSubObjects(Object& _object, map<YulString, shared_ptr<Object const>> const& _subObjects)
+{
+	for (auto& subNode: _object.subObjects)
+		if (auto subObject = dynamic_cast<Object*>(subNode.get()))
+		{
+			if (auto it = _subObjects.find(subObject->name); it != _subObjects.end())
+			{
+				yulAssert(it->second, "");
+				shared_ptr<Object> replacement = it->second->clone();
+				replacement->subId = subObject->subId;
+				subNode = move(replacement);
+			}
+			else
+				replaceSubObjects(*subObject, _subObjects);
+		}
+}
+
 // Duplicated from libsolidity/codegen/CompilerContext.cpp
 // TODO: refactor and remove duplication
 evmasm::Assembly::OptimiserSettings translateOptimiserSettings(
@@ -95,10 +112,15 @@ CharStream const& AssemblyStack::charStream(string const& _sourceName) const
 	return *m_charStream;
 }
 
-bool AssemblyStack::parseAndAnalyze(std::string const& _sourceName, std::string const& _source)
+bool AssemblyStack::parseAndAnalyze(
+	std::string const& _sourceName,
+	std::string const& _source,
+	map<YulString, shared_ptr<Object const>> const& _subObjects
+)
 {
 	m_errors.clear();
 	m_analysisSuccessful = false;
+	m_optimizerRuns = 0;
 	m_charStream = make_unique<CharStream>(_source, _sourceName);
 	shared_ptr<Scanner> scanner = make_shared<Scanner>(*m_charStream);
 	m_parserResult = ObjectParser(m_errorReporter, languageToDialect(m_language, m_evmVersion)).parse(scanner, false);
@@ -106,6 +128,8 @@ bool AssemblyStack::parseAndAnalyze(std::string const& _sourceName, std::string
 		return false;
 	yulAssert(m_parserResult, "");
 	yulAssert(m_parserResult->code, "");
+	if (!_subObjects.empty())
+		replaceSubObjects(*m_parserResult, _subObjects);
 
 	return analyzeParsed();
 }
@@ -120,7 +144,10 @@ void AssemblyStack::optimize()
 	m_analysisSuccessful = false;
 	yulAssert(m_parserResult, "");
 	optimize(*m_parserResult, true);
-	yulAssert(analyzeParsed(), "Invalid source code after optimization.");
+	++m_optimizerRuns;
+	// The optimiser suite already re-analyzes every object it optimizes and copies of cached objects
+	// are analyzed in ``optimize(Object&, bool)``.
+	m_analysisSuccessful = true;
 }
 
 void AssemblyStack::translate(AssemblyStack::Language _targetLanguage)
@@ -132,6 +159,8 @@ void AssemblyStack::translate(AssemblyStack::Language _targetLanguage)
 		m_language == Language::StrictAssembly && _targetLanguage == Language::Ewasm,
 		"Invalid language combination"
 	);
+	// Cached objects are only valid for the source dialect.
+	m_optimizedObjectCache.reset();
 
 	*m_parserResult = EVMToEwasmTranslator(
 		languageToDialect(m_language, m_evmVersion),
@@ -194,7 +223,24 @@ void AssemblyStack::optimize(Object& _object, bool _isCreation)
 	yulAssert(_object.analysisInfo, "");
 	for (auto& subNode: _object.subObjects)
 		if (auto subObject = dynamic_cast<Object*>(subNode.get()))
+		{
+			if (m_optimizedObjectCache)
+				if (shared_ptr<Object> optimized = m_optimizedObjectCache->copy(subObject->name.str(), m_optimizerRuns))
+				{
+					optimized->subId = subObject->subId;
+					yulAssert(analyzeParsed(*optimized), "Invalid source code after optimization.");
+					subNode = move(optimized);
+					continue;
+				}
 			optimize(*subObject, false);
+			if (m_optimizedObjectCache)
+				m_optimizedObjectCache->store(*subObject, m_optimizerRuns);
+		}
+
+	map<YulString, size_t> functionExecutions;
+	if (m_optimiserSettings.functionExecutions.count(_object.name.str()))
+		for (auto const& [function, executions]: m_optimiserSettings.functionExecutions.at(_object.name.str()))
+			functionExecutions[YulString{function}] = executions;
 
 	Dialect const& dialect = languageToDialect(m_language, m_evmVersion);
 	unique_ptr<GasMeter> meter;
@@ -205,9 +251,12 @@ void AssemblyStack::optimize(Object& _object, bool _isCreation)
 		meter.get(),
 		_object,
 		m_optimiserSettings.optimizeStackAllocation,
+		m_optimiserSettings.gasAwareInlining,
 		m_optimiserSettings.yulOptimiserSteps,
 		_isCreation ? nullopt : make_optional(m_optimiserSettings.expectedExecutionsPerDeployment),
-		{}
+		{},
+		m_optimiserProfile.get(),
+		functionExecutions
 	);
 }
 
@@ -29,11 +29,13 @@
 
 #include <libyul/Object.h>
 #include <libyul/ObjectParser.h>
+#include <libyul/OptimizedObjectCache.h>
 
 #include <libsolidity/interface/OptimiserSettings.h>
 
 #include <libevmasm/LinkerObject.h>
 
+#include <map>
 #include <memory>
 #include <string>
 
@@ -50,6 +52,7 @@ class Scanner;
 namespace solidity::yul
 {
 class AbstractAssembly;
+class OptimiserProfile;
 
 
 struct MachineAssemblyObject
@@ -82,12 +85,14 @@ public:
 		langutil::EVMVersion _evmVersion,
 		Language _language,
 		solidity::frontend::OptimiserSettings _optimiserSettings,
-		langutil::DebugInfoSelection const& _debugInfoSelection
+		langutil::DebugInfoSelection const& _debugInfoSelection,
+		std::shared_ptr<OptimizedObjectCache> _optimizedObjectCache = nullptr
 	):
 		m_language(_language),
 		m_evmVersion(_evmVersion),
 		m_optimiserSettings(std::move(_optimiserSettings)),
 		m_debugInfoSelection(_debugInfoSelection),
+		m_optimizedObjectCache(std::move(_optimizedObjectCache)),
 		m_errorReporter(m_errors)
 	{}
 
@@ -96,12 +101,25 @@ public:
 
 	/// Runs parsing and analysis steps, returns false if input cannot be assembled.
 	/// Multiple calls overwrite the previous state.
-	bool parseAndAnalyze(std::string const& _sourceName, std::string const& _source);
+	/// Sub-objects whose name is a key of @a _subObjects are replaced by a copy of the respective
+	/// object before the analysis, so @a _source can refer to already parsed objects using
+	/// empty placeholder objects of the same name.
+	bool parseAndAnalyze(
+		std::string const& _sourceName,
+		std::string const& _source,
+		std::map<YulString, std::shared_ptr<Object const>> const& _subObjects = {}
+	);
 
 	/// Run the optimizer suite. Can only be used with Yul or strict assembly.
 	/// If the settings (see constructor) disabled the optimizer, nothing is done here.
+	/// If an optimized object cache was provided, sub-objects are taken from the cache
+	/// where possible and stored in it otherwise.
 	void optimize();
 
+	/// Records all optimiser step applications of subsequent calls to @a optimize in @a _profile.
+	/// Sub-objects taken from the optimized object cache are not profiled again.
+	void setOptimiserProfile(std::shared_ptr<OptimiserProfile> _profile) { m_optimiserProfile = std::move(_profile); }
+
 	/// Translate the source to a different language / dialect.
 	void translate(Language _targetLanguage);
 
@@ -148,6 +166,10 @@ private:
 	langutil::EVMVersion m_evmVersion;
 	solidity::frontend::OptimiserSettings m_optimiserSettings;
 	langutil::DebugInfoSelection m_debugInfoSelection{};
+	std::shared_ptr<OptimizedObjectCache> m_optimizedObjectCache;
+	std::shared_ptr<OptimiserProfile> m_optimiserProfile;
+	/// Number of times the optimizer ran on the current object.
+	size_t m_optimizerRuns = 0;
 
 	std::unique_ptr<langutil::CharStream> m_charStream;
 
@@ -113,6 +113,10 @@ public:
 	/// The path must not lead to a @a Data object (will throw in that case).
 	std::vector<size_t> pathToSubObject(YulString _qualifiedName) const;
 
+	/// @returns a deep copy of the code of this object and all its sub-objects.
+	/// Data objects are immutable and thus shared. Analysis information is not copied.
+	std::shared_ptr<Object> clone() const;
+
 	/// sub id for object if it is subobject of another object, max value if it is not subobject
 	size_t subId = std::numeric_limits<size_t>::max();
 
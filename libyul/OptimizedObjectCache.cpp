@@ -0,0 +1,36 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/OptimizedObjectCache.h>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+shared_ptr<Object> OptimizedObjectCache::copy(string const& _name, size_t _run) const
+{
+	auto it = m_objects.find({_name, _run});
+	if (it == m_objects.end())
+		return nullptr;
+	return it->second->clone();
+}
+
+void OptimizedObjectCache::store(Object const& _object, size_t _run)
+{
+	m_objects.emplace(make_pair(_object.name.str(), _run), _object.clone());
+}
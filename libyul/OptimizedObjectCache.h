@@ -0,0 +1,56 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Cache of Yul objects that have already been optimized as sub-objects of another object.
+ */
+
+#pragma once
+
+#include <libyul/Object.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace solidity::yul
+{
+
+/**
+ * Stores copies of objects that were optimized as sub-objects, identified by their name and the
+ * number of optimizer runs they went through before. Since the optimization of a sub-object
+ * only depends on the sub-object itself, an object that is contained in many others (like the
+ * code of a contract created via ``new``) only has to be optimized once.
+ *
+ * The cache can be shared between assembly stacks, as long as they use the same dialect and
+ * optimiser settings and all objects of the same name have the same contents.
+ */
+class OptimizedObjectCache
+{
+public:
+	/// @returns a copy of the object named @a _name after optimizer run @a _run or nullptr if there
+	/// is none. The copy is not analyzed yet.
+	std::shared_ptr<Object> copy(std::string const& _name, size_t _run) const;
+	/// Stores a copy of @a _object, which has just been optimized by optimizer run @a _run.
+	void store(Object const& _object, size_t _run);
+
+private:
+	std::map<std::pair<std::string, size_t>, std::shared_ptr<Object const>> m_objects;
+};
+
+}
@@ -46,6 +46,12 @@ bigint GasMeter::instructionCosts(evmasm::Instruction _instruction) const
 	return combineCosts(GasMeterVisitor::instructionCosts(_instruction, m_dialect, m_isCreation));
 }
 
+bigint GasMeter::dataCosts(size_t _bytes) const
+{
+	// Instructions without immediate arguments occupy a single byte.
+	return _bytes * GasMeterVisitor::instructionCosts(evmasm::Instruction::STOP, m_dialect, m_isCreation).second;
+}
+
 bigint GasMeter::combineCosts(std::pair<bigint, bigint> _costs) const
 {
 	return _costs.first * m_runs + _costs.second;
@@ -54,6 +54,12 @@ public:
 	/// the costs for its arguments.
 	bigint instructionCosts(evmasm::Instruction _instruction) const;
 
+	/// @returns the costs of deploying the given number of bytes of code.
+	bigint dataCosts(size_t _bytes) const;
+
+	/// @returns a gas meter for the same code that assumes @a _runs executions instead.
+	GasMeter withRuns(bigint _runs) const { return GasMeter(m_dialect, m_isCreation, std::move(_runs)); }
+
 private:
 	bigint combineCosts(std::pair<bigint, bigint> _costs) const;
 
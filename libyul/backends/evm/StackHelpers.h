@@ -25,11 +25,14 @@
 
 #include <range/v3/algorithm/all_of.hpp>
 #include <range/v3/algorithm/any_of.hpp>
-#include <range/v3/view/enumerate.hpp>
 #include <range/v3/view/iota.hpp>
 #include <range/v3/view/reverse.hpp>
 #include <range/v3/view/take.hpp>
 
+#include <algorithm>
+#include <map>
+#include <vector>
+
 namespace solidity::yul
 {
 
@@ -350,73 +353,93 @@ private:
 template<typename Swap, typename PushOrDup, typename Pop>
 void createStackLayout(Stack& _currentStack, Stack const& _targetStack, Swap _swap, PushOrDup _pushOrDup, Pop _pop)
 {
-	struct ShuffleOperations
+	/// State shared by all iterations of the shuffler.
+	/// Every slot that can occur while shuffling is interned to a dense ID up front, s.t. the shuffling operations
+	/// only compare and count integers instead of stack slots.
+	struct ShuffleState
 	{
 		Stack& currentStack;
 		Stack const& targetStack;
 		Swap swapCallback;
 		PushOrDup pushOrDupCallback;
 		Pop popCallback;
-		std::map<StackSlot, int> multiplicity;
-		ShuffleOperations(
-			Stack& _currentStack,
-			Stack const& _targetStack,
-			Swap _swap,
-			PushOrDup _pushOrDup,
-			Pop _pop
-		):
-			currentStack(_currentStack),
-			targetStack(_targetStack),
-			swapCallback(_swap),
-			pushOrDupCallback(_pushOrDup),
-			popCallback(_pop)
+		/// IDs of the slots in currentStack, kept in sync with currentStack.
+		std::vector<size_t> currentIDs;
+		/// IDs of the slots in targetStack.
+		std::vector<size_t> targetIDs;
+		/// For each offset in targetStack, whether the slot at that offset is a JunkSlot.
+		std::vector<bool> targetIsJunk;
+		/// Multiplicity of each slot indexed by its ID. Recomputed in each iteration.
+		std::vector<int> multiplicity;
+	};
+	struct ShuffleOperations
+	{
+		ShuffleState& state;
+		ShuffleOperations(ShuffleState& _state): state(_state)
 		{
-			for (auto const& slot: currentStack)
-				--multiplicity[slot];
-			for (auto&& [offset, slot]: targetStack | ranges::views::enumerate)
-				if (std::holds_alternative<JunkSlot>(slot) && offset < currentStack.size())
-					++multiplicity[currentStack.at(offset)];
+			std::fill(state.multiplicity.begin(), state.multiplicity.end(), 0);
+			for (size_t id: state.currentIDs)
+				--state.multiplicity[id];
+			for (size_t offset = 0; offset < state.targetIDs.size(); ++offset)
+				if (state.targetIsJunk[offset] && offset < state.currentIDs.size())
+					++state.multiplicity[state.currentIDs[offset]];
 				else
-					++multiplicity[slot];
+					++state.multiplicity[state.targetIDs[offset]];
 		}
 		bool isCompatible(size_t _source, size_t _target)
 		{
 			return
-				_source < currentStack.size() &&
-				_target < targetStack.size() &&
-				(
-					std::holds_alternative<JunkSlot>(targetStack.at(_target)) ||
-					currentStack.at(_source) == targetStack.at(_target)
-				);
+				_source < state.currentIDs.size() &&
+				_target < state.targetIDs.size() &&
+				(state.targetIsJunk[_target] || state.currentIDs[_source] == state.targetIDs[_target]);
 		}
-		bool sourceIsSame(size_t _lhs, size_t _rhs) { return currentStack.at(_lhs) == currentStack.at(_rhs); }
-		int sourceMultiplicity(size_t _offset) { return multiplicity.at(currentStack.at(_offset)); }
-		int targetMultiplicity(size_t _offset) { return multiplicity.at(targetStack.at(_offset)); }
+		bool sourceIsSame(size_t _lhs, size_t _rhs) { return state.currentIDs.at(_lhs) == state.currentIDs.at(_rhs); }
+		int sourceMultiplicity(size_t _offset) { return state.multiplicity[state.currentIDs.at(_offset)]; }
+		int targetMultiplicity(size_t _offset) { return state.multiplicity[state.targetIDs.at(_offset)]; }
 		bool targetIsArbitrary(size_t offset)
 		{
-			return offset < targetStack.size() && std::holds_alternative<JunkSlot>(targetStack.at(offset));
+			return offset < state.targetIDs.size() && state.targetIsJunk[offset];
 		}
 		void swap(size_t _i)
 		{
-			swapCallback(static_cast<unsigned>(_i));
-			std::swap(currentStack.at(currentStack.size() - _i - 1), currentStack.back());
+			state.swapCallback(static_cast<unsigned>(_i));
+			size_t offset = state.currentStack.size() - _i - 1;
+			std::swap(state.currentStack.at(offset), state.currentStack.back());
+			std::swap(state.currentIDs.at(offset), state.currentIDs.back());
 		}
-		size_t sourceSize() { return currentStack.size(); }
-		size_t targetSize() { return targetStack.size(); }
+		size_t sourceSize() { return state.currentIDs.size(); }
+		size_t targetSize() { return state.targetIDs.size(); }
 		void pop()
 		{
-			popCallback();
-			currentStack.pop_back();
+			state.popCallback();
+			state.currentStack.pop_back();
+			state.currentIDs.pop_back();
 		}
 		void pushOrDupTarget(size_t _offset)
 		{
-			auto const& targetSlot = targetStack.at(_offset);
-			pushOrDupCallback(targetSlot);
-			currentStack.push_back(targetSlot);
+			auto const& targetSlot = state.targetStack.at(_offset);
+			state.pushOrDupCallback(targetSlot);
+			state.currentStack.push_back(targetSlot);
+			state.currentIDs.push_back(state.targetIDs.at(_offset));
 		}
 	};
 
-	Shuffler<ShuffleOperations>::shuffle(_currentStack, _targetStack, _swap, _pushOrDup, _pop);
+	ShuffleState state{_currentStack, _targetStack, _swap, _pushOrDup, _pop, {}, {}, {}, {}};
+	std::map<StackSlot, size_t> slotIDs;
+	auto intern = [&](StackSlot const& _slot) { return slotIDs.emplace(_slot, slotIDs.size()).first->second; };
+	state.currentIDs.reserve(_currentStack.size() + _targetStack.size());
+	for (auto const& slot: _currentStack)
+		state.currentIDs.emplace_back(intern(slot));
+	state.targetIDs.reserve(_targetStack.size());
+	state.targetIsJunk.reserve(_targetStack.size());
+	for (auto const& slot: _targetStack)
+	{
+		state.targetIDs.emplace_back(intern(slot));
+		state.targetIsJunk.emplace_back(std::holds_alternative<JunkSlot>(slot));
+	}
+	state.multiplicity.resize(slotIDs.size());
+
+	Shuffler<ShuffleOperations>::shuffle(state);
 
 	yulAssert(_currentStack.size() == _targetStack.size(), "");
 	for (auto&& [current, target]: ranges::zip_view(_currentStack, _targetStack))
@@ -25,6 +25,7 @@
 
 #include <libsolutil/Algorithms.h>
 #include <libsolutil/cxx20.h>
+#include <libsolutil/ThreadPool.h>
 #include <libsolutil/Visitor.h>
 
 #include <range/v3/algorithm/any_of.hpp>
@@ -42,17 +43,41 @@
 #include <range/v3/view/take_last.hpp>
 #include <range/v3/view/transform.hpp>
 
+#include <future>
+
 using namespace solidity;
 using namespace solidity::yul;
 using namespace std;
 
-StackLayout StackLayoutGenerator::run(CFG const& _cfg)
+StackLayout StackLayoutGenerator::run(CFG const& _cfg, optional<size_t> _threads)
 {
+	// The layouts of different functions only depend on the graph of the function itself, so they are generated
+	// concurrently, unless there are too few functions to make up for starting the threads.
+	size_t const minFunctionsPerThread = 8;
+	if (!_threads)
+		_threads = _cfg.functionInfo.size() >= 2 * minFunctionsPerThread ?
+			min(util::ThreadPool::defaultThreadCount(), _cfg.functionInfo.size() / minFunctionsPerThread) :
+			0;
+	util::ThreadPool threadPool{*_threads};
+	vector<future<StackLayout>> functionLayouts;
+	for (auto& functionInfo: _cfg.functionInfo | ranges::views::values)
+		functionLayouts.emplace_back(threadPool.submit([entry = functionInfo.entry]() {
+			StackLayout functionLayout;
+			StackLayoutGenerator{functionLayout}.processEntryPoint(*entry);
+			return functionLayout;
+		}));
+
 	StackLayout stackLayout;
 	StackLayoutGenerator{stackLayout}.processEntryPoint(*_cfg.entry);
 
-	for (auto& functionInfo: _cfg.functionInfo | ranges::views::values)
-		StackLayoutGenerator{stackLayout}.processEntryPoint(*functionInfo.entry);
+	// The layouts refer to disjoint sets of blocks and operations.
+	for (auto& functionLayout: functionLayouts)
+	{
+		StackLayout layout = functionLayout.get();
+		stackLayout.blockInfos.merge(layout.blockInfos);
+		stackLayout.operationEntryLayout.merge(layout.operationEntryLayout);
+		yulAssert(layout.blockInfos.empty() && layout.operationEntryLayout.empty(), "");
+	}
 
 	return stackLayout;
 }
@@ -262,6 +287,7 @@ Stack createIdealLayout(Stack const& _operationOutput, Stack const& _post, Calla
 		return *s;
 	}) | ranges::to<Stack>;
 }
+
 }
 
 Stack StackLayoutGenerator::propagateStackThroughOperation(Stack _exitStack, CFG::Operation const& _operation, bool _aggressiveStackCompression)
@@ -331,6 +357,7 @@ Stack StackLayoutGenerator::propagateStackThroughBlock(Stack _exitStack, CFG::Ba
 
 void StackLayoutGenerator::processEntryPoint(CFG::BasicBlock const& _entry)
 {
+	m_combinedStacks.clear();
 	list<CFG::BasicBlock const*> toVisit{&_entry};
 	set<CFG::BasicBlock const*> visited;
 
@@ -541,11 +568,61 @@ void StackLayoutGenerator::stitchConditionalJumps(CFG::BasicBlock const& _block)
 	});
 }
 
-Stack StackLayoutGenerator::combineStack(Stack const& _stack1, Stack const& _stack2)
+Stack StackLayoutGenerator::mergeAlongCommonSubsequence(Stack const& _stack1, Stack const& _stack2)
+{
+	size_t const size1 = _stack1.size();
+	size_t const size2 = _stack2.size();
+	// commonLength[i][j] is the length of a longest common subsequence of _stack1[i:] and _stack2[j:].
+	vector<vector<size_t>> commonLength(size1 + 1, vector<size_t>(size2 + 1, 0));
+	for (size_t i = size1; i-- > 0;)
+		for (size_t j = size2; j-- > 0;)
+			commonLength[i][j] = _stack1[i] == _stack2[j] ?
+				commonLength[i + 1][j + 1] + 1 :
+				max(commonLength[i + 1][j], commonLength[i][j + 1]);
+
+	// Slots of _stack2 that also occur in _stack1 are placed at their position in _stack1.
+	set<StackSlot> const slots1(_stack1.begin(), _stack1.end());
+	Stack result;
+	size_t i = 0;
+	size_t j = 0;
+	while (i < size1 || j < size2)
+		if (i < size1 && j < size2 && _stack1[i] == _stack2[j])
+		{
+			result.emplace_back(_stack1[i]);
+			++i;
+			++j;
+		}
+		else if (j < size2 && (i == size1 || commonLength[i][j + 1] >= commonLength[i + 1][j]))
+		{
+			if (!slots1.count(_stack2[j]))
+				result.emplace_back(_stack2[j]);
+			++j;
+		}
+		else
+			result.emplace_back(_stack1[i++]);
+	return result;
+}
+
+Stack StackLayoutGenerator::combineStack(Stack const& _stack1, Stack const& _stack2) const
 {
-	// TODO: it would be nicer to replace this by a constructive algorithm.
-	// Currently it uses a reduced version of the Heap Algorithm to partly brute-force, which seems
-	// to work decently well.
+	// The layouts of jump targets rarely change while iterating over backwards jumps, so the same
+	// pairs of stacks are combined over and over again.
+	auto key = make_pair(_stack1, _stack2);
+	if (Stack const* cached = util::valueOrNullptr(m_combinedStacks, key))
+		return *cached;
+	Stack combined = computeCombinedStack(_stack1, _stack2);
+	// Only recently combined stacks are likely to be combined again, so instead of keeping track of
+	// their use, all of them are dropped once there are too many.
+	if (m_combinedStacks.size() >= c_maxCombinedStacks)
+		m_combinedStacks.clear();
+	m_combinedStacks.emplace(move(key), combined);
+	return combined;
+}
+
+Stack StackLayoutGenerator::computeCombinedStack(Stack const& _stack1, Stack const& _stack2)
+{
+	// This uses a reduced version of the Heap Algorithm to partly brute-force, which seems to work decently
+	// well for small stacks. For wide stacks a constructive merge is evaluated as an additional candidate.
 
 	Stack commonPrefix;
 	for (auto&& [slot1, slot2]: ranges::zip_view(_stack1, _stack2))
@@ -592,10 +669,34 @@ Stack StackLayoutGenerator::combineStack(Stack const& _stack1, Stack const& _sta
 		return numOps;
 	};
 
-	// See https://en.wikipedia.org/wiki/Heap's_algorithm
 	size_t n = candidate.size();
 	Stack bestCandidate = candidate;
 	size_t bestCost = evaluate(candidate);
+	// No permutation can improve on a candidate from which both stacks can be reached without swapping.
+	if (bestCost == 0)
+		return commonPrefix + bestCandidate;
+
+	if (n > c_maxSearchedCombinationSize)
+	{
+		auto withoutDuplicates = [&](Stack const& _stack) {
+			Stack result;
+			for (auto const& slot: _stack)
+				if (!util::contains(result, slot) && util::contains(candidate, slot))
+					result.emplace_back(slot);
+			return result;
+		};
+		Stack merged = mergeAlongCommonSubsequence(withoutDuplicates(stack1Tail), withoutDuplicates(stack2Tail));
+		yulAssert(merged.size() == n, "");
+		// The merge is only one more candidate, since the search can still find a cheaper layout.
+		size_t cost = evaluate(merged);
+		if (cost < bestCost)
+		{
+			bestCost = cost;
+			bestCandidate = move(merged);
+		}
+	}
+
+	// See https://en.wikipedia.org/wiki/Heap's_algorithm
 	std::vector<size_t> c(n, 0);
 	size_t i = 1;
 	while (i < n)
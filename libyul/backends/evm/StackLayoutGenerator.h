@@ -24,6 +24,8 @@
 #include <libyul/backends/evm/ControlFlowGraph.h>
 
 #include <map>
+#include <optional>
+#include <utility>
 
 namespace solidity::yul
 {
@@ -55,7 +57,10 @@ public:
 		std::vector<YulString> variableChoices;
 	};
 
-	static StackLayout run(CFG const& _cfg);
+	/// Generates the layouts of the functions in @a _cfg concurrently on @a _threads worker threads or, if
+	/// @a _threads is not given, on as many threads as the number of functions warrants. With zero threads
+	/// all layouts are generated on the calling thread. The result does not depend on the number of threads.
+	static StackLayout run(CFG const& _cfg, std::optional<size_t> _threads = std::nullopt);
 	/// @returns a map from function names to the stack too deep errors occurring in that function.
 	/// Requires @a _cfg to be a control flow graph generated from disambiguated Yul.
 	/// The empty string is mapped to the stack too deep errors of the main entry point.
@@ -65,6 +70,12 @@ public:
 	/// If @a _functionName is empty, the stack too deep errors of the main entry point are reported instead.
 	static std::vector<StackTooDeep> reportStackTooDeep(CFG const& _cfg, YulString _functionName);
 
+	/// @returns a layout that contains every slot of @a _stack1 and @a _stack2 exactly once, keeps all slots of
+	/// @a _stack1 in their relative order and keeps as many slots of @a _stack2 as possible in their relative order,
+	/// i.e. a shortest common supersequence of both stacks built along one of their longest common subsequences.
+	/// Requires both stacks to be free of duplicates.
+	static Stack mergeAlongCommonSubsequence(Stack const& _stack1, Stack const& _stack2);
+
 private:
 	StackLayoutGenerator(StackLayout& _context);
 
@@ -100,7 +111,10 @@ private:
 
 	/// Calculates the ideal stack layout, s.t. both @a _stack1 and @a _stack2 can be achieved with minimal
 	/// stack shuffling when starting from the returned layout.
-	static Stack combineStack(Stack const& _stack1, Stack const& _stack2);
+	/// The results are memoized in m_combinedStacks for the entry point currently processed.
+	Stack combineStack(Stack const& _stack1, Stack const& _stack2) const;
+	/// Uncached implementation of combineStack.
+	static Stack computeCombinedStack(Stack const& _stack1, Stack const& _stack2);
 
 	/// Walks through the CFG and reports any stack too deep errors that would occur when generating code for it
 	/// without countermeasures.
@@ -111,7 +125,16 @@ private:
 	/// stack @a _stack.
 	static Stack compressStack(Stack _stack);
 
+	/// Maximal number of distinct slots to be combined, for which combineStack only searches through
+	/// permutations and does not consider a constructive merge.
+	static constexpr size_t c_maxSearchedCombinationSize = 16;
+	/// Maximal number of results of combineStack kept in m_combinedStacks.
+	static constexpr size_t c_maxCombinedStacks = 256;
+
 	StackLayout& m_layout;
+	/// Results of combineStack for the entry point currently processed. Cleared at the start of
+	/// every entry point and whenever it reaches c_maxCombinedStacks entries.
+	mutable std::map<std::pair<Stack, Stack>, Stack> m_combinedStacks;
 };
 
 }
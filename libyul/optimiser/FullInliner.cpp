@@ -27,6 +27,7 @@
 #include <libyul/optimiser/SSAValueTracker.h>
 #include <libyul/optimiser/Semantics.h>
 #include <libyul/optimiser/CallGraphGenerator.h>
+#include <libyul/backends/evm/EVMMetrics.h>
 #include <libyul/Exceptions.h>
 #include <libyul/AST.h>
 #include <libyul/Dialect.h>
@@ -40,13 +41,29 @@ using namespace solidity::yul;
 
 void FullInliner::run(OptimiserStepContext& _context, Block& _ast)
 {
-	FullInliner inliner{_ast, _context.dispenser, _context.dialect};
+	FullInliner inliner{
+		_ast,
+		_context.dispenser,
+		_context.dialect,
+		_context.inliningGasMeter,
+		_context.functionExecutions
+	};
 	inliner.run(Pass::InlineTiny);
 	inliner.run(Pass::InlineRest);
 }
 
-FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect):
-	m_ast(_ast), m_nameDispenser(_dispenser), m_dialect(_dialect)
+FullInliner::FullInliner(
+	Block& _ast,
+	NameDispenser& _dispenser,
+	Dialect const& _dialect,
+	GasMeter const* _gasMeter,
+	map<YulString, size_t> const* _functionExecutions
+):
+	m_ast(_ast),
+	m_nameDispenser(_dispenser),
+	m_dialect(_dialect),
+	m_gasMeter(_gasMeter),
+	m_functionExecutions(_functionExecutions)
 {
 	// Determine constants
 	SSAValueTracker tracker;
@@ -69,6 +86,8 @@ FullInliner::FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const&
 		// Always inline functions that are only called once.
 		if (references[fun.name] == 1)
 			m_singleUse.emplace(fun.name);
+		if (m_gasMeter)
+			m_callCosts[fun.name] = callCosts(fun);
 		updateCodeSize(fun);
 	}
 }
@@ -165,7 +184,7 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite)
 	if (!calledFunction)
 		return false;
 
-	if (m_noInlineFunctions.count(_funCall.functionName.name) || recursive(*calledFunction))
+	if (m_noInlineFunctions.count(_funCall.functionName.name) || m_recursiveFunctions.count(calledFunction->name))
 		return false;
 
 	// Inline really, really tiny functions
@@ -196,7 +215,13 @@ bool FullInliner::shallInline(FunctionCall const& _funCall, YulString _callSite)
 			break;
 		}
 
-	return (size < 6 || (constantArg && size < 12));
+	if (size < 6 || (constantArg && size < 12))
+		return true;
+
+	// Inline larger functions if avoiding the call is expected to save more gas
+	// than deploying the additional code costs.
+	// We roughly assume two bytes of bytecode per unit of code size.
+	return m_gasMeter && m_gasMeter->dataCosts(2 * size) < m_callCosts.at(calledFunction->name);
 }
 
 void FullInliner::tentativelyUpdateCodeSize(YulString _function, YulString _callSite)
@@ -207,6 +232,10 @@ void FullInliner::tentativelyUpdateCodeSize(YulString _function, YulString _call
 void FullInliner::updateCodeSize(FunctionDefinition const& _fun)
 {
 	m_functionSizes[_fun.name] = CodeSize::codeSize(_fun.body);
+	if (ReferencesCounter::countReferences(_fun).count(_fun.name))
+		m_recursiveFunctions.insert(_fun.name);
+	else
+		m_recursiveFunctions.erase(_fun.name);
 }
 
 void FullInliner::handleBlock(YulString _currentFunctionName, Block& _block)
@@ -214,10 +243,20 @@ void FullInliner::handleBlock(YulString _currentFunctionName, Block& _block)
 	InlineModifier{*this, m_nameDispenser, _currentFunctionName, m_dialect}(_block);
 }
 
-bool FullInliner::recursive(FunctionDefinition const& _fun) const
+bigint FullInliner::callCosts(FunctionDefinition const& _fun) const
 {
-	map<YulString, size_t> references = ReferencesCounter::countReferences(_fun);
-	return references[_fun.name] > 0;
+	yulAssert(m_gasMeter, "");
+	GasMeter const meter =
+		m_functionExecutions && m_functionExecutions->count(_fun.name) ?
+		m_gasMeter->withRuns(m_functionExecutions->at(_fun.name)) :
+		*m_gasMeter;
+	// Pushing the return label and the function tag (two bytes each),
+	// jumping into the function and back and swapping arguments and return values.
+	return
+		2 * (meter.instructionCosts(evmasm::Instruction::PUSH2) + meter.dataCosts(2)) +
+		2 * meter.instructionCosts(evmasm::Instruction::JUMP) +
+		2 * meter.instructionCosts(evmasm::Instruction::JUMPDEST) +
+		(_fun.parameters.size() + _fun.returnVariables.size()) * meter.instructionCosts(evmasm::Instruction::SWAP1);
 }
 
 void InlineModifier::operator()(Block& _block)
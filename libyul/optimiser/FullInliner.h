@@ -30,6 +30,8 @@
 
 #include <liblangutil/SourceLocation.h>
 
+#include <libsolutil/Numeric.h>
+
 #include <optional>
 #include <set>
 #include <utility>
@@ -38,6 +40,7 @@ namespace solidity::yul
 {
 
 class NameCollector;
+class GasMeter;
 
 
 /**
@@ -64,6 +67,12 @@ class NameCollector;
  * code of f, with replacements: a -> f_a, b -> f_b, c -> f_c
  * let z := f_c
  *
+ * If the step context provides a gas meter, functions that are too large for the
+ * size-based heuristic are still inlined as long as the estimated costs of calling
+ * them (including the expected number of executions) exceed the costs of the code
+ * added by inlining. For functions with recorded executions, the recorded number is used
+ * instead of the expected number of executions of the whole code.
+ *
  * Prerequisites: Disambiguator
  * More efficient if run after: Function Hoister, Expression Splitter
  */
@@ -93,16 +102,27 @@ public:
 private:
 	enum Pass { InlineTiny, InlineRest };
 
-	FullInliner(Block& _ast, NameDispenser& _dispenser, Dialect const& _dialect);
+	FullInliner(
+		Block& _ast,
+		NameDispenser& _dispenser,
+		Dialect const& _dialect,
+		GasMeter const* _gasMeter = nullptr,
+		std::map<YulString, size_t> const* _functionExecutions = nullptr
+	);
 	void run(Pass _pass);
 
 	/// @returns a map containing the maximum depths of a call chain starting at each
 	/// function. For recursive functions, the value is one larger than for all others.
 	std::map<YulString, size_t> callDepths() const;
 
+	/// Re-computes the size of the function and whether it is recursive.
+	/// Has to be called whenever the body of the function changed.
 	void updateCodeSize(FunctionDefinition const& _fun);
 	void handleBlock(YulString _currentFunctionName, Block& _block);
-	bool recursive(FunctionDefinition const& _fun) const;
+	/// @returns the estimated costs of a single call to the function, i.e. of jumping
+	/// into it and back and of reordering arguments and return values.
+	/// Only depends on the signature of the function and its recorded number of executions.
+	bigint callCosts(FunctionDefinition const& _fun) const;
 
 	Pass m_pass;
 	/// The AST to be modified. The root block itself will not be modified, because
@@ -116,8 +136,14 @@ private:
 	/// Variables that are constants (used for inlining heuristic)
 	std::set<YulString> m_constants;
 	std::map<YulString, size_t> m_functionSizes;
+	/// Functions that call themselves, updated together with the function sizes.
+	std::set<YulString> m_recursiveFunctions;
+	/// Estimated costs of calling each function, only present if @a m_gasMeter is set.
+	std::map<YulString, bigint> m_callCosts;
 	NameDispenser& m_nameDispenser;
 	Dialect const& m_dialect;
+	GasMeter const* m_gasMeter = nullptr;
+	std::map<YulString, size_t> const* m_functionExecutions = nullptr;
 };
 
 /**
@@ -61,6 +61,13 @@ void FunctionSpecializer::operator()(FunctionCall& _f)
 	)
 		return;
 
+	if (
+		m_functionExecutions &&
+		m_functionExecutions->count(_f.functionName.name) &&
+		m_functionExecutions->at(_f.functionName.name) == 0
+	)
+		return;
+
 	LiteralArguments arguments = specializableArguments(_f);
 
 	if (ranges::any_of(arguments, [](auto& _a) { return _a.has_value(); }))
@@ -130,7 +137,8 @@ void FunctionSpecializer::run(OptimiserStepContext& _context, Block& _ast)
 	FunctionSpecializer f{
 		CallGraphGenerator::callGraph(_ast).recursiveFunctions(),
 		_context.dispenser,
-		_context.dialect
+		_context.dialect,
+		_context.functionExecutions
 	};
 	f(_ast);
 
@@ -47,6 +47,9 @@ namespace solidity::yul
  * Other optimization steps will be able to make more simplifications to the function. The
  * optimization step is mainly useful for functions that would not be inlined.
  *
+ * Functions that were never executed according to the recorded executions in the step context
+ * are not specialized, since the copies would only increase the code size.
+ *
  * Prerequisites: Disambiguator, FunctionHoister
  *
  * LiteralRematerialiser is recommended as a prerequisite, even though it's not required for
@@ -69,11 +72,13 @@ private:
 	explicit FunctionSpecializer(
 		std::set<YulString> _recursiveFunctions,
 		NameDispenser& _nameDispenser,
-		Dialect const& _dialect
+		Dialect const& _dialect,
+		std::map<YulString, size_t> const* _functionExecutions = nullptr
 	):
 		m_recursiveFunctions(std::move(_recursiveFunctions)),
 		m_nameDispenser(_nameDispenser),
-		m_dialect(_dialect)
+		m_dialect(_dialect),
+		m_functionExecutions(_functionExecutions)
 	{}
 	/// Returns a vector of Expressions, where the index `i` is an expression if the function's
 	/// `i`-th argument can be specialized, nullopt otherwise.
@@ -108,6 +113,7 @@ private:
 
 	NameDispenser& m_nameDispenser;
 	Dialect const& m_dialect;
+	std::map<YulString, size_t> const* m_functionExecutions = nullptr;
 };
 
 }
@@ -0,0 +1,207 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+
+#include <libyul/optimiser/OptimiserProfile.h>
+
+#include <libyul/optimiser/ASTWalker.h>
+#include <libyul/optimiser/Metrics.h>
+#include <libyul/AST.h>
+
+#include <utility>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::yul;
+
+namespace
+{
+
+/**
+ * Computes a hash of the names and the structure of the code of every function and of the code
+ * outside of functions. The code of nested functions does not contribute to the hash of the
+ * enclosing code.
+ */
+class CodeFingerprinter: public ASTWalker
+{
+public:
+	static map<YulString, uint64_t> run(Block const& _ast)
+	{
+		CodeFingerprinter fingerprinter;
+		fingerprinter(_ast);
+		fingerprinter.m_fingerprints[YulString{}] = fingerprinter.m_hash;
+		return move(fingerprinter.m_fingerprints);
+	}
+
+	using ASTWalker::operator();
+	void operator()(Literal const& _literal) override
+	{
+		add(static_cast<uint64_t>(_literal.kind));
+		add(_literal.value);
+	}
+	void operator()(Identifier const& _identifier) override { add(_identifier.name); }
+	void operator()(FunctionCall const& _call) override
+	{
+		add(_call.functionName.name);
+		add(_call.arguments.size());
+		ASTWalker::operator()(_call);
+	}
+	void operator()(Assignment const& _assignment) override
+	{
+		for (auto const& variable: _assignment.variableNames)
+			add(variable.name);
+		ASTWalker::operator()(_assignment);
+	}
+	void operator()(VariableDeclaration const& _declaration) override
+	{
+		for (auto const& variable: _declaration.variables)
+			add(variable.name);
+		add(_declaration.value ? 1 : 0);
+		ASTWalker::operator()(_declaration);
+	}
+	void operator()(Switch const& _switch) override
+	{
+		add(_switch.cases.size());
+		ASTWalker::operator()(_switch);
+	}
+	void operator()(FunctionDefinition const& _function) override
+	{
+		uint64_t enclosingHash = exchange(m_hash, YulStringRepository::emptyHash());
+		for (auto const& parameter: _function.parameters)
+			add(parameter.name);
+		add(_function.parameters.size());
+		for (auto const& returnVariable: _function.returnVariables)
+			add(returnVariable.name);
+		ASTWalker::operator()(_function);
+		m_fingerprints[_function.name] = m_hash;
+		m_hash = enclosingHash;
+	}
+	void operator()(Block const& _block) override
+	{
+		add(_block.statements.size());
+		ASTWalker::operator()(_block);
+	}
+	void visit(Statement const& _statement) override
+	{
+		add(_statement.index());
+		ASTWalker::visit(_statement);
+	}
+	void visit(Expression const& _expression) override
+	{
+		add(_expression.index());
+		ASTWalker::visit(_expression);
+	}
+
+private:
+	void add(uint64_t _value)
+	{
+		m_hash ^= _value;
+		m_hash *= 1099511628211u;
+	}
+	void add(YulString _name) { add(_name.hash()); }
+
+	uint64_t m_hash = YulStringRepository::emptyHash();
+	map<YulString, uint64_t> m_fingerprints;
+};
+
+}
+
+void OptimiserProfile::run(
+	OptimiserStep const& _step,
+	OptimiserStepContext& _context,
+	Block& _ast,
+	string const& _object,
+	size_t _round
+)
+{
+	run(_step.name, _ast, _object, [&]() { _step.run(_context, _ast); });
+	m_applications.back().round = _round;
+}
+
+void OptimiserProfile::run(
+	string const& _step,
+	Block const& _ast,
+	string const& _object,
+	function<void()> const& _apply
+)
+{
+	StepApplication application;
+	application.object = _object;
+	application.step = _step;
+	application.codeSizeBefore = CodeSize::codeSizeIncludingFunctions(_ast);
+	map<YulString, uint64_t> fingerprintsBefore = CodeFingerprinter::run(_ast);
+
+	auto start = chrono::steady_clock::now();
+	_apply();
+	application.time = chrono::steady_clock::now() - start;
+
+	application.codeSizeAfter = CodeSize::codeSizeIncludingFunctions(_ast);
+	map<YulString, uint64_t> fingerprintsAfter = CodeFingerprinter::run(_ast);
+	for (auto const& [name, fingerprint]: fingerprintsBefore)
+	{
+		auto after = fingerprintsAfter.find(name);
+		if (after == fingerprintsAfter.end() || after->second != fingerprint)
+			application.changedFunctions.emplace_back(name);
+	}
+	for (auto const& entry: fingerprintsAfter)
+		if (!fingerprintsBefore.count(entry.first))
+			application.changedFunctions.emplace_back(entry.first);
+
+	m_applications.emplace_back(move(application));
+}
+
+Json::Value OptimiserProfile::toJson() const
+{
+	auto toMicroseconds = [](chrono::steady_clock::duration _time) {
+		return Json::Int64(chrono::duration_cast<chrono::microseconds>(_time).count());
+	};
+
+	Json::Value steps{Json::arrayValue};
+	map<string, chrono::steady_clock::duration> totalTime;
+	map<string, Json::Value> summary;
+	for (StepApplication const& application: m_applications)
+	{
+		Json::Value step{Json::objectValue};
+		step["object"] = application.object;
+		step["step"] = application.step;
+		step["round"] = Json::UInt64(application.round);
+		step["time"] = toMicroseconds(application.time);
+		step["codeSizeBefore"] = Json::UInt64(application.codeSizeBefore);
+		step["codeSizeAfter"] = Json::UInt64(application.codeSizeAfter);
+		step["changedFunctions"] = Json::arrayValue;
+		for (YulString function: application.changedFunctions)
+			step["changedFunctions"].append(function.str());
+		steps.append(move(step));
+
+		totalTime[application.step] += application.time;
+		Json::Value& stepSummary = summary[application.step];
+		stepSummary["applications"] = stepSummary.get("applications", 0).asUInt64() + 1;
+		stepSummary["changes"] =
+			stepSummary.get("changes", 0).asUInt64() +
+			(application.changedFunctions.empty() ? 0 : 1);
+	}
+
+	Json::Value result{Json::objectValue};
+	result["steps"] = move(steps);
+	result["summary"] = Json::objectValue;
+	for (auto&& [step, stepSummary]: summary)
+	{
+		stepSummary["time"] = toMicroseconds(totalTime.at(step));
+		result["summary"][step] = move(stepSummary);
+	}
+	return result;
+}
@@ -0,0 +1,91 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Profile of the optimiser steps applied by the optimiser suite.
+ */
+
+#pragma once
+
+#include <libyul/optimiser/OptimiserStep.h>
+#include <libyul/YulString.h>
+
+#include <json/json.h>
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace solidity::yul
+{
+
+/**
+ * Records the wall time, the code size before and after and the changed functions of every
+ * application of an optimiser step, if passed to the OptimiserSuite.
+ *
+ * Whether a function changed is determined by comparing fingerprints of its code, which are
+ * far cheaper to compute than copies of the AST, but may in very rare cases miss a change.
+ */
+class OptimiserProfile
+{
+public:
+	struct StepApplication
+	{
+		/// Name of the optimized object.
+		std::string object;
+		/// Name of the optimiser step.
+		std::string step;
+		/// Zero-based round of the innermost repeated (bracketed) part of the sequence,
+		/// zero outside of brackets.
+		size_t round = 0;
+		std::chrono::steady_clock::duration time{};
+		size_t codeSizeBefore = 0;
+		size_t codeSizeAfter = 0;
+		/// Names of the functions that were added, removed or changed by the step.
+		/// The empty name stands for the code outside of functions.
+		std::vector<YulString> changedFunctions;
+	};
+
+	/// Runs @a _step on @a _ast and records the application.
+	void run(
+		OptimiserStep const& _step,
+		OptimiserStepContext& _context,
+		Block& _ast,
+		std::string const& _object,
+		size_t _round
+	);
+	/// Calls @a _apply, which applies the optimisation stage named @a _step to @a _ast, and records the
+	/// application. Used for stages like the stack compressor that are not part of the step sequence.
+	void run(
+		std::string const& _step,
+		Block const& _ast,
+		std::string const& _object,
+		std::function<void()> const& _apply
+	);
+
+	std::vector<StepApplication> const& applications() const { return m_applications; }
+
+	/// @returns all step applications in order, together with the total time, the number of applications
+	/// and the number of applications that changed the code for each step.
+	Json::Value toJson() const;
+
+private:
+	std::vector<StepApplication> m_applications;
+};
+
+}
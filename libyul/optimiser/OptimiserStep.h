@@ -20,6 +20,7 @@
 
 #include <libyul/Exceptions.h>
 
+#include <map>
 #include <optional>
 #include <string>
 #include <set>
@@ -31,6 +32,7 @@ struct Dialect;
 struct Block;
 class YulString;
 class NameDispenser;
+class GasMeter;
 
 struct OptimiserStepContext
 {
@@ -39,6 +41,12 @@ struct OptimiserStepContext
 	std::set<YulString> const& reservedIdentifiers;
 	/// The value nullopt represents creation code
 	std::optional<size_t> expectedExecutionsPerDeployment;
+	/// If set, the full inliner also inlines functions whose call overhead is expected
+	/// to cost more gas than the additional code.
+	GasMeter const* inliningGasMeter = nullptr;
+	/// Recorded number of executions per deployment of individual functions, if available.
+	/// Takes precedence over @a expectedExecutionsPerDeployment for these functions.
+	std::map<YulString, size_t> const* functionExecutions = nullptr;
 };
 
 
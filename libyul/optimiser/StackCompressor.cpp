@@ -21,6 +21,7 @@
 
 #include <libyul/optimiser/StackCompressor.h>
 
+#include <libyul/optimiser/ASTCopier.h>
 #include <libyul/optimiser/NameCollector.h>
 #include <libyul/optimiser/Rematerialiser.h>
 #include <libyul/optimiser/UnusedPruner.h>
@@ -39,6 +40,12 @@
 #include <libyul/AST.h>
 
 #include <libsolutil/CommonData.h>
+#include <libsolutil/cxx20.h>
+
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/map.hpp>
+
+#include <optional>
 
 using namespace std;
 using namespace solidity;
@@ -213,6 +220,39 @@ void eliminateVariables(
 	UnusedPruner::runUntilStabilised(_dialect, _block, _allowMSizeOptimization);
 }
 
+/// @returns a copy of @a _object that only retains the code of the functions named in @a _functionNames,
+/// or of the main block, if the empty name is included. The main block is replaced by an empty block
+/// and all other functions by functions with the same signature and an empty body.
+/// Requires the function grouper to have run on the code of @a _object.
+Object restrictToFunctions(Object const& _object, set<YulString> const& _functionNames)
+{
+	Object restricted = _object;
+	restricted.analysisInfo = nullptr;
+	restricted.code = make_shared<Block>(Block{_object.code->debugData, {}});
+	vector<Statement>& statements = restricted.code->statements;
+	statements.reserve(_object.code->statements.size());
+	Block const& mainBlock = std::get<Block>(_object.code->statements.at(0));
+	if (_functionNames.count({}))
+		statements.emplace_back(ASTCopier{}.translate(mainBlock));
+	else
+		statements.emplace_back(Block{mainBlock.debugData, {}});
+	for (size_t i = 1; i < _object.code->statements.size(); ++i)
+	{
+		auto const& function = std::get<FunctionDefinition>(_object.code->statements[i]);
+		if (_functionNames.count(function.name))
+			statements.emplace_back(ASTCopier{}.translate(_object.code->statements[i]));
+		else
+			statements.emplace_back(FunctionDefinition{
+				function.debugData,
+				function.name,
+				function.parameters,
+				function.returnVariables,
+				Block{function.body.debugData, {}}
+			});
+	}
+	return restricted;
+}
+
 }
 
 bool StackCompressor::run(
@@ -238,28 +278,30 @@ bool StackCompressor::run(
 	{
 		yul::AsmAnalysisInfo analysisInfo = yul::AsmAnalyzer::analyzeStrictAssertCorrect(_dialect, _object);
 		unique_ptr<CFG> cfg = ControlFlowGraphBuilder::build(analysisInfo, _dialect, *_object.code);
-		Block& mainBlock = std::get<Block>(_object.code->statements.at(0));
-		if (
-			auto stackTooDeepErrors = StackLayoutGenerator::reportStackTooDeep(*cfg, YulString{});
-			!stackTooDeepErrors.empty()
-		)
-			eliminateVariables(_dialect, mainBlock, stackTooDeepErrors, allowMSizeOptimzation);
-		for (size_t i = 1; i < _object.code->statements.size(); ++i)
-		{
-			auto& fun = std::get<FunctionDefinition>(_object.code->statements[i]);
-			if (
-				auto stackTooDeepErrors = StackLayoutGenerator::reportStackTooDeep(*cfg, fun.name);
-				!stackTooDeepErrors.empty()
-			)
-				eliminateVariables(_dialect, fun.body, stackTooDeepErrors, allowMSizeOptimzation);
-		}
+		run(_dialect, _object, StackLayoutGenerator::reportStackTooDeep(*cfg));
 	}
 	else
+	{
+		// The stack deficit of a function only depends on its own code, so after the first iteration
+		// only the functions that have been changed in the previous iteration are checked again.
+		optional<set<YulString>> changedFunctions;
 		for (size_t iterations = 0; iterations < _maxIterations; iterations++)
 		{
-			map<YulString, int> stackSurplus = CompilabilityChecker(_dialect, _object, _optimizeStackAllocation).stackDeficit;
+			map<YulString, int> stackSurplus;
+			if (changedFunctions)
+			{
+				stackSurplus = CompilabilityChecker(
+					_dialect,
+					restrictToFunctions(_object, *changedFunctions),
+					_optimizeStackAllocation
+				).stackDeficit;
+				cxx20::erase_if(stackSurplus, [&](auto const& _entry) { return !changedFunctions->count(_entry.first); });
+			}
+			else
+				stackSurplus = CompilabilityChecker(_dialect, _object, _optimizeStackAllocation).stackDeficit;
 			if (stackSurplus.empty())
 				return true;
+			changedFunctions = stackSurplus | ranges::views::keys | ranges::to<set<YulString>>;
 
 			if (stackSurplus.count(YulString{}))
 			{
@@ -287,6 +329,31 @@ bool StackCompressor::run(
 				);
 			}
 		}
+	}
 	return false;
 }
 
+void StackCompressor::run(
+	Dialect const& _dialect,
+	Object& _object,
+	map<YulString, vector<StackLayoutGenerator::StackTooDeep>> const& _stackTooDeepErrors
+)
+{
+	yulAssert(
+		_object.code &&
+		_object.code->statements.size() > 0 && holds_alternative<Block>(_object.code->statements.at(0)),
+		"Need to run the function grouper before the stack compressor."
+	);
+	bool allowMSizeOptimzation = !MSizeFinder::containsMSize(_dialect, *_object.code);
+	Block& mainBlock = std::get<Block>(_object.code->statements.at(0));
+	if (auto const* stackTooDeepErrors = util::valueOrNullptr(_stackTooDeepErrors, YulString{}))
+		if (!stackTooDeepErrors->empty())
+			eliminateVariables(_dialect, mainBlock, *stackTooDeepErrors, allowMSizeOptimzation);
+	for (size_t i = 1; i < _object.code->statements.size(); ++i)
+	{
+		auto& fun = std::get<FunctionDefinition>(_object.code->statements[i]);
+		if (auto const* stackTooDeepErrors = util::valueOrNullptr(_stackTooDeepErrors, fun.name))
+			if (!stackTooDeepErrors->empty())
+				eliminateVariables(_dialect, fun.body, *stackTooDeepErrors, allowMSizeOptimzation);
+	}
+}
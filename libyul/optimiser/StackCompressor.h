@@ -22,9 +22,12 @@
 
 #pragma once
 
+#include <libyul/backends/evm/StackLayoutGenerator.h>
 #include <libyul/Object.h>
 
+#include <map>
 #include <memory>
+#include <vector>
 
 namespace solidity::yul
 {
@@ -52,6 +55,14 @@ public:
 		bool _optimizeStackAllocation,
 		size_t _maxIterations
 	);
+	/// Removes local variables to resolve @a _stackTooDeepErrors, which have to be the errors
+	/// StackLayoutGenerator::reportStackTooDeep reports for the current code of @a _object.
+	/// Only for use with the optimized code generator.
+	static void run(
+		Dialect const& _dialect,
+		Object& _object,
+		std::map<YulString, std::vector<StackLayoutGenerator::StackTooDeep>> const& _stackTooDeepErrors
+	);
 };
 
 }
@@ -61,7 +61,11 @@
 #include <libyul/optimiser/LoopInvariantCodeMotion.h>
 #include <libyul/optimiser/Metrics.h>
 #include <libyul/optimiser/NameSimplifier.h>
+#include <libyul/optimiser/OptimiserProfile.h>
 #include <libyul/backends/evm/ConstantOptimiser.h>
+#include <libyul/backends/evm/ControlFlowGraphBuilder.h>
+#include <libyul/backends/evm/EVMMetrics.h>
+#include <libyul/backends/evm/StackLayoutGenerator.h>
 #include <libyul/AsmAnalysis.h>
 #include <libyul/AsmAnalysisInfo.h>
 #include <libyul/AsmPrinter.h>
@@ -75,11 +79,13 @@
 
 #include <libyul/CompilabilityChecker.h>
 
+#include <range/v3/algorithm/all_of.hpp>
 #include <range/v3/view/map.hpp>
 #include <range/v3/action/remove.hpp>
 
 #include <limits>
 #include <tuple>
+#include <variant>
 
 using namespace std;
 using namespace solidity;
@@ -90,9 +96,12 @@ void OptimiserSuite::run(
 	GasMeter const* _meter,
 	Object& _object,
 	bool _optimizeStackAllocation,
+	bool _gasAwareInlining,
 	string_view _optimisationSequence,
 	optional<size_t> _expectedExecutionsPerDeployment,
-	set<YulString> const& _externallyUsedIdentifiers
+	set<YulString> const& _externallyUsedIdentifiers,
+	OptimiserProfile* _profile,
+	map<YulString, size_t> const& _functionExecutions
 )
 {
 	EVMDialect const* evmDialect = dynamic_cast<EVMDialect const*>(&_dialect);
@@ -113,8 +122,14 @@ void OptimiserSuite::run(
 
 	NameDispenser dispenser{_dialect, ast, reservedIdentifiers};
 	OptimiserStepContext context{_dialect, dispenser, reservedIdentifiers, _expectedExecutionsPerDeployment};
+	if (!_functionExecutions.empty())
+		context.functionExecutions = &_functionExecutions;
+	// Recorded executions only change the inlining decisions if gas-aware inlining is enabled.
+	if (_gasAwareInlining)
+		context.inliningGasMeter = _meter;
 
-	OptimiserSuite suite(context, Debug::None);
+	OptimiserSuite suite(context, Debug::None, _profile);
+	suite.m_objectName = _object.name.str();
 
 	// Some steps depend on properties ensured by FunctionHoister, BlockFlattener, FunctionGrouper and
 	// ForLoopInitRewriter. Run them first to be able to run arbitrary sequences safely.
@@ -128,31 +143,62 @@ void OptimiserSuite::run(
 	size_t stackCompressorMaxIterations = 16;
 	suite.runSequence("g", ast);
 
+	// The stack compressor is not part of the sequence, but recorded in the profile like its steps.
+	auto runStackCompressor = [&](function<void()> const& _compress) {
+		if (_profile)
+			_profile->run("StackCompressor", ast, suite.m_objectName, _compress);
+		else
+			_compress();
+	};
+
 	// We ignore the return value because we will get a much better error
 	// message once we perform code generation.
 	if (!usesOptimizedCodeGenerator)
-		StackCompressor::run(
-			_dialect,
-			_object,
-			_optimizeStackAllocation,
-			stackCompressorMaxIterations
-		);
+		runStackCompressor([&]() {
+			StackCompressor::run(
+				_dialect,
+				_object,
+				_optimizeStackAllocation,
+				stackCompressorMaxIterations
+			);
+		});
 	suite.runSequence("fDnTOc g", ast);
 
 	if (evmDialect)
 	{
 		yulAssert(_meter, "");
-		ConstantOptimiser{*evmDialect, *_meter}(ast);
+		ConstantOptimiser constantOptimiser{*evmDialect, *_meter};
+		for (Statement& statement: ast.statements)
+		{
+			// Functions with recorded executions use their own trade-off between size and gas.
+			FunctionDefinition* function = get_if<FunctionDefinition>(&statement);
+			if (function && _functionExecutions.count(function->name))
+			{
+				GasMeter meter = _meter->withRuns(_functionExecutions.at(function->name));
+				ConstantOptimiser{*evmDialect, meter}(*function);
+			}
+			else
+				std::visit(constantOptimiser, statement);
+		}
 		if (usesOptimizedCodeGenerator)
 		{
-			StackCompressor::run(
-				_dialect,
-				_object,
-				_optimizeStackAllocation,
-				stackCompressorMaxIterations
-			);
-			if (evmDialect->providesObjectAccess())
+			// Both the stack compressor and the stack limit evader start from the stack too deep errors
+			// of the object. If there are none, the stack compressor does not change the code, so the
+			// errors only have to be determined once.
+			map<YulString, vector<StackLayoutGenerator::StackTooDeep>> stackTooDeepErrors;
+			{
+				AsmAnalysisInfo analysisInfo = AsmAnalyzer::analyzeStrictAssertCorrect(_dialect, _object);
+				unique_ptr<CFG> cfg = ControlFlowGraphBuilder::build(analysisInfo, _dialect, ast);
+				stackTooDeepErrors = StackLayoutGenerator::reportStackTooDeep(*cfg);
+			}
+			// The errors of the main block are always reported, even if there are none.
+			if (ranges::all_of(stackTooDeepErrors | ranges::views::values, [](auto const& _errors) { return _errors.empty(); }))
+				StackLimitEvader::run(suite.m_context, _object, stackTooDeepErrors);
+			else
+			{
+				runStackCompressor([&]() { StackCompressor::run(_dialect, _object, stackTooDeepErrors); });
 				StackLimitEvader::run(suite.m_context, _object);
+			}
 		}
 		else if (evmDialect->providesObjectAccess() && _optimizeStackAllocation)
 			StackLimitEvader::run(suite.m_context, _object);
@@ -396,9 +442,12 @@ void OptimiserSuite::runSequence(string_view _stepAbbreviations, Block& _ast, bo
 			subsequences.push_back({subsequence, true});
 	}
 
+	size_t const enclosingRound = m_round;
 	size_t codeSize = 0;
 	for (size_t round = 0; round < MaxRounds; ++round)
 	{
+		if (_repeatUntilStable)
+			m_round = round;
 		for (auto const& [subsequence, repeat]: subsequences)
 		{
 			if (repeat)
@@ -415,6 +464,7 @@ void OptimiserSuite::runSequence(string_view _stepAbbreviations, Block& _ast, bo
 			break;
 		codeSize = newSize;
 	}
+	m_round = enclosingRound;
 }
 
 void OptimiserSuite::runSequence(std::vector<string> const& _steps, Block& _ast)
@@ -426,7 +476,10 @@ void OptimiserSuite::runSequence(std::vector<string> const& _steps, Block& _ast)
 	{
 		if (m_debug == Debug::PrintStep)
 			cout << "Running " << step << endl;
-		allSteps().at(step)->run(m_context, _ast);
+		if (m_profile)
+			m_profile->run(*allSteps().at(step), m_context, _ast, m_objectName, m_round);
+		else
+			allSteps().at(step)->run(m_context, _ast);
 		if (m_debug == Debug::PrintChanges)
 		{
 			// TODO should add switch to also compare variable names!
@@ -39,6 +39,7 @@ struct AsmAnalysisInfo;
 struct Dialect;
 class GasMeter;
 struct Object;
+class OptimiserProfile;
 
 /**
  * Optimiser suite that combines all steps and also provides the settings for the heuristics.
@@ -59,17 +60,27 @@ public:
 		PrintStep,
 		PrintChanges
 	};
-	OptimiserSuite(OptimiserStepContext& _context, Debug _debug = Debug::None): m_context(_context), m_debug(_debug) {}
+	/// If @a _profile is given, every step application is recorded in it.
+	OptimiserSuite(OptimiserStepContext& _context, Debug _debug = Debug::None, OptimiserProfile* _profile = nullptr):
+		m_context(_context), m_debug(_debug), m_profile(_profile)
+	{}
 
 	/// The value nullopt for `_expectedExecutionsPerDeployment` represents creation code.
+	/// If `_gasAwareInlining` is set, the full inliner uses `_meter` to weigh call overhead
+	/// against code size.
+	/// `_functionExecutions` contains the recorded number of executions of functions of the object.
+	/// The full inliner only uses it if `_gasAwareInlining` is set.
 	static void run(
 		Dialect const& _dialect,
 		GasMeter const* _meter,
 		Object& _object,
 		bool _optimizeStackAllocation,
+		bool _gasAwareInlining,
 		std::string_view _optimisationSequence,
 		std::optional<size_t> _expectedExecutionsPerDeployment,
-		std::set<YulString> const& _externallyUsedIdentifiers = {}
+		std::set<YulString> const& _externallyUsedIdentifiers = {},
+		OptimiserProfile* _profile = nullptr,
+		std::map<YulString, size_t> const& _functionExecutions = {}
 	);
 
 	/// Ensures that specified sequence of step abbreviations is well-formed and can be executed.
@@ -86,6 +97,11 @@ public:
 private:
 	OptimiserStepContext& m_context;
 	Debug m_debug;
+	OptimiserProfile* m_profile = nullptr;
+	/// Name of the optimized object, only used for profiling.
+	std::string m_objectName;
+	/// Round of the innermost repeated subsequence that is currently running, only used for profiling.
+	size_t m_round = 0;
 };
 
 }
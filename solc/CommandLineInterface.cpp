@@ -52,8 +52,11 @@
 #include <libsolutil/CommonData.h>
 #include <libsolutil/CommonIO.h>
 #include <libsolutil/JSON.h>
+#include <libsolutil/ThreadPool.h>
 
 #include <algorithm>
+#include <chrono>
+#include <iomanip>
 #include <memory>
 
 #include <range/v3/view/map.hpp>
@@ -318,6 +321,53 @@ void CommandLineInterface::handleStorageLayout(string const& _contract)
 		sout() << "Contract Storage Layout:" << endl << data << endl;
 }
 
+void CommandLineInterface::handlePhaseTimings()
+{
+	solAssert(m_options.input.mode == InputMode::Compiler || m_options.input.mode == InputMode::CompilerWithASTImport, "");
+
+	if (!m_options.compiler.timePasses)
+		return;
+
+	auto milliseconds = [](chrono::microseconds _time) {
+		return static_cast<double>(_time.count()) / 1000.0;
+	};
+	auto printTiming = [&](string const& _name, chrono::microseconds _wallTime, chrono::microseconds _cpuTime) {
+		serr() << "   " << left << setw(50) << _name << right << fixed << setprecision(3);
+		serr() << setw(12) << milliseconds(_wallTime) << " ms wall";
+		serr() << setw(12) << milliseconds(_cpuTime) << " ms cpu";
+	};
+
+	// Totals per phase, in the order in which the phases first finished.
+	vector<string> phases;
+	map<string, pair<chrono::microseconds, chrono::microseconds>> totals;
+	serr() << "Compilation phases:" << endl;
+	for (util::PhaseTiming const& timing: m_compiler->phaseTimings())
+	{
+		printTiming(timing.contract.empty() ? timing.phase : timing.phase + " (" + timing.contract + ")", timing.wallTime, timing.cpuTime);
+		if (timing.peakMemoryIncrease)
+			serr() << setw(12) << static_cast<double>(*timing.peakMemoryIncrease) / (1024 * 1024) << " MiB peak increase";
+		serr() << endl;
+
+		if (!totals.count(timing.phase))
+			phases.emplace_back(timing.phase);
+		totals[timing.phase].first += timing.wallTime;
+		totals[timing.phase].second += timing.cpuTime;
+	}
+
+	chrono::microseconds totalWallTime{};
+	chrono::microseconds totalCpuTime{};
+	serr() << "Total per phase:" << endl;
+	for (string const& phase: phases)
+	{
+		printTiming(phase, totals[phase].first, totals[phase].second);
+		serr() << endl;
+		totalWallTime += totals[phase].first;
+		totalCpuTime += totals[phase].second;
+	}
+	printTiming("total", totalWallTime, totalCpuTime);
+	serr() << defaultfloat << endl;
+}
+
 void CommandLineInterface::handleNatspec(bool _natspecDev, string const& _contract)
 {
 	solAssert(m_options.input.mode == InputMode::Compiler || m_options.input.mode == InputMode::CompilerWithASTImport, "");
@@ -619,7 +669,8 @@ bool CommandLineInterface::processInput()
 		solAssert(m_standardJsonInput.has_value(), "");
 
 		StandardCompiler compiler(m_fileReader.reader(), m_options.formatting.json);
-		sout() << compiler.compile(move(m_standardJsonInput.value())) << endl;
+		compiler.compile(m_standardJsonInput.value(), sout());
+		sout() << endl;
 		m_standardJsonInput.reset();
 		break;
 	}
@@ -703,6 +754,7 @@ bool CommandLineInterface::compile()
 		);
 
 		m_compiler->setOptimiserSettings(m_options.optimiserSettings());
+		m_compiler->enablePhaseTimings(m_options.compiler.timePasses);
 
 		if (m_options.input.mode == InputMode::CompilerWithASTImport)
 		{
@@ -726,6 +778,7 @@ bool CommandLineInterface::compile()
 		{
 			m_compiler->setSources(m_fileReader.sourceCodes());
 			m_compiler->setParserErrorRecovery(m_options.input.errorRecovery);
+			m_compiler->setParserThreads(util::ThreadPool::defaultThreadCount());
 		}
 
 		bool successful = m_compiler->compile(m_options.output.stopAfter);
@@ -736,6 +789,8 @@ bool CommandLineInterface::compile()
 			formatter.printErrorInformation(*error);
 		}
 
+		handlePhaseTimings();
+
 		if (!successful)
 			return m_options.input.errorRecovery;
 	}
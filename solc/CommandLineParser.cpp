@@ -100,6 +100,7 @@ static string const g_strSourceList = "sourceList";
 static string const g_strStandardJSON = "standard-json";
 static string const g_strStrictAssembly = "strict-assembly";
 static string const g_strSwarm = "swarm";
+static string const g_strTimePasses = "time-passes";
 static string const g_strPrettyJson = "pretty-json";
 static string const g_strJsonIndent = "json-indent";
 static string const g_strVersion = "version";
@@ -237,6 +238,7 @@ bool CommandLineOptions::operator==(CommandLineOptions const& _other) const noex
 		formatting.withErrorIds == _other.formatting.withErrorIds &&
 		compiler.outputs == _other.compiler.outputs &&
 		compiler.estimateGas == _other.compiler.estimateGas &&
+		compiler.timePasses == _other.compiler.timePasses &&
 		compiler.combinedJsonRequests == _other.compiler.combinedJsonRequests &&
 		metadata.hash == _other.metadata.hash &&
 		metadata.literalSources == _other.metadata.literalSources &&
@@ -729,6 +731,10 @@ General Information)").c_str(),
 			g_strGas.c_str(),
 			"Print an estimate of the maximal gas usage for each function."
 		)
+		(
+			g_strTimePasses.c_str(),
+			"Print the wall time and processor time of each compilation phase and by how much it increased the peak memory usage of the process to stderr."
+		)
 		(
 			g_strCombinedJson.c_str(),
 			po::value<string>()->value_name(joinHumanReadable(CombinedJsonRequests::componentMap() | ranges::views::keys, ",")),
@@ -912,6 +918,7 @@ bool CommandLineParser::processArgs()
 		// TODO: This should eventually contain all options.
 		{g_strErrorRecovery, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 		{g_strExperimentalViaIR, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
+		{g_strTimePasses, {InputMode::Compiler, InputMode::CompilerWithASTImport}},
 	};
 	vector<string> invalidOptionsForCurrentInputMode;
 	for (auto const& [optionName, inputModes]: validOptionInputModeCombinations)
@@ -1034,6 +1041,7 @@ bool CommandLineParser::processArgs()
 		return false;
 
 	m_options.compiler.estimateGas = (m_args.count(g_strGas) > 0);
+	m_options.compiler.timePasses = (m_args.count(g_strTimePasses) > 0);
 
 	if (m_args.count(g_strBasePath))
 		m_options.input.basePath = m_args[g_strBasePath].as<string>();
@@ -209,6 +209,7 @@ struct CommandLineOptions
 	{
 		CompilerOutputs outputs;
 		bool estimateGas = false;
+		bool timePasses = false;
 		std::optional<CombinedJsonRequests> combinedJsonRequests;
 	} compiler;
 
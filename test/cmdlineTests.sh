@@ -193,6 +193,7 @@ import re, sys
 json = open("$stdout_path", "r").read()
 json = re.sub(r"{[^{}]*Warning: This is a pre-release compiler version[^{}]*},?", "", json)
 json = re.sub(r"},\s*]", "}]", json)                  # },] -> }]
+json = re.sub(r",?\s*\"errors\":\s*\[\s*\]\s*(?=})","",json)  # Remove "errors" array if it's empty and written last
 json = re.sub(r"\"errors\":\s*\[\s*\],?\s*","",json)  # Remove "errors" array if it's not empty
 json = re.sub("\n\\s+\n", "\n\n", json)               # Remove any leftover trailing whitespace
 open("$stdout_path", "w").write(json)
@@ -200,6 +201,8 @@ EOF
         sed -i.bak -E -e 's/ Consider adding \\"pragma solidity \^[0-9.]*;\\"//g' "$stdout_path"
         sed -i.bak -E -e 's/\"opcodes\":\"[^"]+\"/\"opcodes\":\"<OPCODES REMOVED>\"/g' "$stdout_path"
         sed -i.bak -E -e 's/\"sourceMap\":\"[0-9:;-]+\"/\"sourceMap\":\"<SOURCEMAP REMOVED>\"/g' "$stdout_path"
+        # Remove solver times from the model checker query statistics.
+        sed -i.bak -E -e 's/\"timeMicroseconds\":[0-9]+/\"timeMicroseconds\":\"<TIME REMOVED>\"/g' "$stdout_path"
 
         # Remove bytecode (but not linker references).
         sed -i.bak -E -e 's/(\"object\":\")[0-9a-f]+([^"]*\")/\1<BYTECODE REMOVED>\2/g' "$stdout_path"
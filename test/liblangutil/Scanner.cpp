@@ -1026,6 +1026,25 @@ BOOST_AUTO_TEST_CASE(yul_function_with_whitespace)
 	BOOST_CHECK_EQUAL(scanner.next(), Token::EOS);
 }
 
+BOOST_AUTO_TEST_CASE(long_comments_and_identifiers)
+{
+	string comment(10000, 'x');
+	string identifier(10000, 'a');
+	TestScanner scanner(
+		"/* " + comment + " */ /*/ " + comment + " */" + identifier + "// " + comment + "\n" +
+		"\t\t  " + identifier + " 1_000_000 /* unterminated"
+	);
+	BOOST_CHECK_EQUAL(scanner.currentToken(), Token::Identifier);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), identifier);
+	BOOST_CHECK_EQUAL(scanner.currentLocation().start, 20014);
+	BOOST_CHECK_EQUAL(scanner.next(), Token::Identifier);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), identifier);
+	BOOST_CHECK_EQUAL(scanner.next(), Token::Number);
+	BOOST_CHECK_EQUAL(scanner.currentLiteral(), "1_000_000");
+	BOOST_CHECK_EQUAL(scanner.next(), Token::Illegal);
+	BOOST_CHECK_EQUAL(scanner.currentError(), ScannerError::IllegalCommentTerminator);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -25,9 +25,13 @@
 #include <test/Common.h>
 
 #include <liblangutil/Exceptions.h>
+#include <liblangutil/SourceReferenceFormatter.h>
+#include <libsolidity/ast/ASTJsonConverter.h>
 #include <libsolidity/interface/CompilerStack.h>
 #include <libsolidity/interface/ImportRemapper.h>
 
+#include <libsolutil/JSON.h>
+
 #include <boost/test/unit_test.hpp>
 
 #include <string>
@@ -113,6 +117,47 @@ BOOST_AUTO_TEST_CASE(context_dependent_remappings_order_independent_2)
 	BOOST_CHECK(c.compile());
 }
 
+BOOST_AUTO_TEST_CASE(concurrent_parsing_matches_sequential_parsing)
+{
+	auto parse = [](StringMap const& _sources, size_t _parserThreads) {
+		CompilerStack c;
+		c.setSources(_sources);
+		c.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+		c.setParserThreads(_parserThreads);
+		c.parseAndAnalyze();
+		Json::Value result{Json::objectValue};
+		result["errors"] = Json::arrayValue;
+		for (auto const& error: c.errors())
+			result["errors"].append(langutil::SourceReferenceFormatter::formatErrorInformation(*error, c));
+		if (!langutil::Error::containsErrors(c.errors()))
+			for (string const& sourceName: c.sourceNames())
+				result["ast"][sourceName] = ASTJsonConverter(c.state(), c.sourceIndices()).toJson(c.ast(sourceName));
+		return result;
+	};
+
+	string const header = "// SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0;\n";
+	StringMap const validSources{
+		{"a.sol", header + "import \"c.sol\"; import \"b.sol\"; contract A is B, C { function f() public pure returns (uint r) { assembly { r := add(1, 2) } } }"},
+		{"b.sol", header + "import \"d.sol\"; contract B is D { uint x; }"},
+		{"c.sol", header + "contract C { function g() public pure returns (uint r) { assembly { function h() -> y { y := 7 } r := h() } } }"},
+		{"d.sol", header + "import \"c.sol\"; contract D is C { event E(uint); }"},
+		{"e.sol", header + "library L { function l(uint a) internal pure returns (uint) { return a * 2; } }"}
+	};
+	StringMap invalidSources = validSources;
+	invalidSources["b.sol"] = header + "contract B { uint x }";
+	invalidSources["e.sol"] = "library L { function l() internal { assembly { let } } }";
+	invalidSources["f.sol"] = header + "import \"missing.sol\"; contract F {}";
+
+	for (StringMap const& sources: {validSources, invalidSources})
+	{
+		Json::Value sequential = parse(sources, 0);
+		for (size_t threads: {1u, 2u, 8u})
+			BOOST_CHECK_EQUAL(util::jsonPrettyPrint(parse(sources, threads)), util::jsonPrettyPrint(sequential));
+	}
+	BOOST_CHECK(parse(validSources, 0)["errors"].empty());
+	BOOST_CHECK(!parse(invalidSources, 0)["errors"].empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
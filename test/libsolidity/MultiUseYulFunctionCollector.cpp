@@ -0,0 +1,199 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for sharing Yul utility functions between function collectors.
+ */
+
+#include <libsolidity/codegen/MultiUseYulFunctionCollector.h>
+#include <libsolidity/interface/CompilerStack.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+
+using namespace std;
+using namespace solidity::langutil;
+
+namespace solidity::frontend::test
+{
+
+namespace
+{
+
+/// Requests a set of functions with nested dependencies from @a _collector and counts
+/// how often each function was generated in @a _generated.
+string requestFunctions(MultiUseYulFunctionCollector& _collector, map<string, size_t>& _generated)
+{
+	auto function = [&](string const& _name, string const& _body) {
+		++_generated[_name];
+		return "function " + _name + "() { " + _body + " }\n";
+	};
+	auto b = [&] {
+		return _collector.createSharedFunction("b", [&] { return function("b", ""); });
+	};
+	auto local = [&] {
+		return _collector.createFunction("local", [&] { return function("local", b() + "()"); });
+	};
+	auto c = [&] {
+		return _collector.createSharedFunction("c", [&](vector<string>& _args, vector<string>&) {
+			++_generated["c"];
+			_args = {"x"};
+			return b() + "()";
+		});
+	};
+	auto d = [&] {
+		return _collector.createSharedFunction("d", [&] { return function("d", local() + "()"); });
+	};
+	auto a = [&] {
+		return _collector.createSharedFunction("a", [&] { return function("a", c() + "(1) " + b() + "()"); });
+	};
+
+	a();
+	d();
+	c();
+	return _collector.requestedFunctions();
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(MultiUseYulFunctionCollectorTest)
+
+BOOST_AUTO_TEST_CASE(share_functions)
+{
+	map<string, size_t> generated;
+	MultiUseYulFunctionCollector reference(nullptr, EVMVersion{}, RevertStrings::Default);
+	string const expectation = requestFunctions(reference, generated);
+
+	auto cache = make_shared<MultiUseYulFunctionCache>();
+	for (size_t i = 0; i < 3; ++i)
+	{
+		MultiUseYulFunctionCollector collector(cache, EVMVersion{}, RevertStrings::Default);
+		BOOST_CHECK_EQUAL(requestFunctions(collector, generated), expectation);
+	}
+
+	// Shared functions are only generated once. Functions that are not shared and functions
+	// that depend on them are generated again for each collector.
+	BOOST_CHECK_EQUAL(generated["a"], 2);
+	BOOST_CHECK_EQUAL(generated["b"], 2);
+	BOOST_CHECK_EQUAL(generated["c"], 2);
+	BOOST_CHECK_EQUAL(generated["d"], 4);
+	BOOST_CHECK_EQUAL(generated["local"], 4);
+}
+
+BOOST_AUTO_TEST_CASE(settings_are_part_of_key)
+{
+	map<string, size_t> generated;
+	auto cache = make_shared<MultiUseYulFunctionCache>();
+	MultiUseYulFunctionCollector first(cache, EVMVersion{}, RevertStrings::Default);
+	MultiUseYulFunctionCollector second(cache, EVMVersion{}, RevertStrings::Debug);
+	BOOST_CHECK_EQUAL(requestFunctions(first, generated), requestFunctions(second, generated));
+	BOOST_CHECK_EQUAL(generated["a"], 2);
+	BOOST_CHECK(cache->find({EVMVersion{}, RevertStrings::Debug, "a"}));
+	BOOST_CHECK(!cache->find({EVMVersion{}, RevertStrings::Strip, "a"}));
+}
+
+BOOST_AUTO_TEST_CASE(share_ast_independent_functions_between_compilations)
+{
+	map<string, size_t> generated;
+	auto request = [&](MultiUseYulFunctionCollector& _collector) {
+		auto function = [&](string const& _name, string const& _body) {
+			++generated[_name];
+			return "function " + _name + "() { " + _body + " }\n";
+		};
+		auto inner = [&] {
+			return _collector.createSharedFunction("independent_inner", [&] { return function("independent_inner", ""); });
+		};
+		_collector.createSharedFunction(
+			"independent_outer",
+			[&] { return function("independent_outer", inner() + "()"); },
+			true
+		);
+		return _collector.requestedFunctions();
+	};
+
+	// Collectors without a cache for their compilation, e.g. from different compilations.
+	auto astIndependentCache = make_shared<MultiUseYulFunctionCache>();
+	MultiUseYulFunctionCollector first(nullptr, EVMVersion{}, RevertStrings::Default, astIndependentCache);
+	MultiUseYulFunctionCollector second(nullptr, EVMVersion{}, RevertStrings::Default, astIndependentCache);
+	MultiUseYulFunctionCollector otherSettings(nullptr, EVMVersion{}, RevertStrings::Strip, astIndependentCache);
+	MultiUseYulFunctionCollector unshared(nullptr, EVMVersion{}, RevertStrings::Default);
+	string const expectation = request(first);
+	BOOST_CHECK_EQUAL(request(second), expectation);
+	BOOST_CHECK_EQUAL(request(otherSettings), expectation);
+	BOOST_CHECK_EQUAL(generated["independent_outer"], 2);
+	BOOST_CHECK_EQUAL(generated["independent_inner"], 2);
+
+	// Without the cache, nothing is shared.
+	BOOST_CHECK_EQUAL(request(unshared), expectation);
+	BOOST_CHECK_EQUAL(generated["independent_outer"], 3);
+	BOOST_CHECK(astIndependentCache->find({EVMVersion{}, RevertStrings::Default, "independent_inner"}));
+}
+
+BOOST_AUTO_TEST_CASE(evict_least_recently_used_functions)
+{
+	auto key = [](string const& _name) { return MultiUseYulFunctionCache::Key{EVMVersion{}, RevertStrings::Default, _name}; };
+	MultiUseYulFunctionCache cache(2);
+	cache.store(key("a"), {"function a() {}", {}});
+	cache.store(key("b"), {"function b() {}", {}});
+	BOOST_CHECK(cache.find(key("a")));
+	cache.store(key("c"), {"function c() {}", {}});
+	BOOST_CHECK(cache.find(key("a")));
+	BOOST_CHECK(!cache.find(key("b")));
+	BOOST_CHECK(cache.find(key("c")));
+	BOOST_CHECK_EQUAL(cache.hits(), 3);
+
+	// Cached functions keep the functions they depend on even after those were evicted.
+	map<string, size_t> generated;
+	MultiUseYulFunctionCollector reference(nullptr, EVMVersion{}, RevertStrings::Default);
+	string const expectation = requestFunctions(reference, generated);
+	auto smallCache = make_shared<MultiUseYulFunctionCache>(1);
+	for (size_t i = 0; i < 3; ++i)
+	{
+		MultiUseYulFunctionCollector collector(smallCache, EVMVersion{}, RevertStrings::Default);
+		BOOST_CHECK_EQUAL(requestFunctions(collector, generated), expectation);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(compilations_share_ast_independent_functions)
+{
+	char const* sourceCode = R"(
+		contract C {
+			function f(uint[] memory a, bytes calldata b) external pure returns (bytes memory) {
+				return abi.encode(a, b);
+			}
+		}
+	)";
+	auto compile = [&] {
+		CompilerStack compilerStack;
+		compilerStack.setSources({{"A.sol", sourceCode}});
+		BOOST_REQUIRE_MESSAGE(compilerStack.compile(), "Compiling contract failed");
+	};
+
+	// The first compilation may or may not find functions cached by earlier tests, but the
+	// second one, using a separate compiler stack, finds the ones the first one generated.
+	compile();
+	size_t const hits = MultiUseYulFunctionCache::processWide()->hits();
+	compile();
+	BOOST_CHECK_GT(MultiUseYulFunctionCache::processWide()->hits(), hits);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -22,6 +22,10 @@
 #include <test/Metadata.h>
 #include <test/Common.h>
 
+#include <libsolidity/codegen/ir/Common.h>
+#include <libyul/AssemblyStack.h>
+
+#include <boost/algorithm/string/predicate.hpp>
 #include <boost/test/unit_test.hpp>
 
 using namespace std;
@@ -51,6 +55,64 @@ BOOST_AUTO_TEST_CASE(does_not_include_creation_time_only_internal_functions)
 	BOOST_CHECK(runtimeBytecode.size() <= 30);
 }
 
+BOOST_AUTO_TEST_CASE(via_ir_output_matches_reparsed_ir)
+{
+	char const* sourceCode = R"(
+		pragma solidity >=0.0;
+		// SPDX-License-Identifier: GPL-3.0
+		contract D {
+			uint public y;
+			constructor(uint _y) { y = _y; }
+		}
+		contract C {
+			uint[] x;
+			function f(uint n) public returns (uint sum) {
+				for (uint i = 0; i < n; ++i)
+					x.push(i * 3);
+				for (uint i = 0; i < x.length; ++i)
+					sum += x[i];
+			}
+			function g() public returns (uint) {
+				return new D(f(7)).y();
+			}
+		}
+	)";
+	for (bool optimize: {false, true})
+	{
+		OptimiserSettings settings = optimize ? OptimiserSettings::standard() : OptimiserSettings::minimal();
+		CompilerStack compiler;
+		compiler.setSources({{"", sourceCode}});
+		compiler.setEVMVersion(solidity::test::CommonOptions::get().evmVersion());
+		compiler.setOptimiserSettings(settings);
+		compiler.setViaIR(true);
+		BOOST_REQUIRE(compiler.compile());
+
+		// The optimized IR is the printed result of optimizing the parsed unoptimized IR.
+		yul::AssemblyStack irStack(
+			solidity::test::CommonOptions::get().evmVersion(),
+			yul::AssemblyStack::Language::StrictAssembly,
+			settings,
+			langutil::DebugInfoSelection::Default()
+		);
+		BOOST_REQUIRE(irStack.parseAndAnalyze("", compiler.yulIR("C")));
+		irStack.optimize();
+		BOOST_CHECK(boost::ends_with(compiler.yulIROptimized("C"), irStack.print(&compiler)));
+
+		// The bytecode is the one obtained by parsing and optimizing the printed optimized IR.
+		yul::AssemblyStack evmStack(
+			solidity::test::CommonOptions::get().evmVersion(),
+			yul::AssemblyStack::Language::StrictAssembly,
+			settings,
+			langutil::DebugInfoSelection::Default()
+		);
+		BOOST_REQUIRE(evmStack.parseAndAnalyze("", compiler.yulIROptimized("C")));
+		evmStack.optimize();
+		auto [assembly, runtimeAssembly] = evmStack.assembleEVMWithDeployed(IRNames::deployedObject(compiler.contractDefinition("C")));
+		BOOST_CHECK(assembly->assemble().bytecode == compiler.object("C").bytecode);
+		BOOST_CHECK(runtimeAssembly->assemble().bytecode == compiler.runtimeObject("C").bytecode);
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
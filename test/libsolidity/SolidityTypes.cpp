@@ -218,6 +218,68 @@ BOOST_AUTO_TEST_CASE(type_identifiers)
 	BOOST_CHECK_EQUAL(InaccessibleDynamicType().identifier(), "t_inaccessible");
 }
 
+BOOST_AUTO_TEST_CASE(interned_types)
+{
+	Type const* uint256 = TypeProvider::uint256();
+	BOOST_CHECK(TypeProvider::array(DataLocation::Memory, uint256) == TypeProvider::array(DataLocation::Memory, uint256));
+	BOOST_CHECK(TypeProvider::array(DataLocation::Memory, uint256) != TypeProvider::array(DataLocation::Storage, uint256));
+	BOOST_CHECK(TypeProvider::array(DataLocation::Memory, uint256, 3) == TypeProvider::array(DataLocation::Memory, uint256, 3));
+	BOOST_CHECK(TypeProvider::array(DataLocation::Memory, uint256, 3) != TypeProvider::array(DataLocation::Memory, uint256, 4));
+	BOOST_CHECK(TypeProvider::array(DataLocation::CallData, true) == TypeProvider::array(DataLocation::CallData, true));
+	BOOST_CHECK(TypeProvider::array(DataLocation::CallData, true) != TypeProvider::array(DataLocation::CallData, false));
+	BOOST_CHECK(TypeProvider::mapping(uint256, TypeProvider::boolean()) == TypeProvider::mapping(uint256, TypeProvider::boolean()));
+	BOOST_CHECK(TypeProvider::tuple({uint256, TypeProvider::boolean()}) == TypeProvider::tuple({uint256, TypeProvider::boolean()}));
+	BOOST_CHECK(TypeProvider::tuple({uint256, TypeProvider::boolean()}) != TypeProvider::tuple({TypeProvider::boolean(), uint256}));
+
+	ArrayType const* storageArray = TypeProvider::array(DataLocation::Storage, uint256);
+	ReferenceType const* memoryArray = TypeProvider::withLocation(storageArray, DataLocation::Memory, true);
+	BOOST_CHECK(memoryArray == TypeProvider::withLocation(storageArray, DataLocation::Memory, true));
+	BOOST_CHECK(*memoryArray == *TypeProvider::array(DataLocation::Memory, uint256));
+	BOOST_CHECK(TypeProvider::arraySlice(*storageArray) == TypeProvider::arraySlice(*storageArray));
+
+	// Struct and contract types are equal, but not interned.
+	int64_t id = 0;
+	StructDefinition s(++id, {}, make_shared<string>("Struct"), {}, {});
+	s.annotation().recursive = false;
+	BOOST_CHECK(*TypeProvider::structType(s, DataLocation::Memory) == *TypeProvider::structType(s, DataLocation::Memory));
+	BOOST_CHECK(TypeProvider::structType(s, DataLocation::Memory) != TypeProvider::structType(s, DataLocation::Memory));
+	ContractDefinition c(++id, SourceLocation{}, make_shared<string>("C"), SourceLocation{}, {}, {}, {}, ContractKind::Contract);
+	BOOST_CHECK(*TypeProvider::contract(c) == *TypeProvider::contract(c));
+	BOOST_CHECK(TypeProvider::contract(c) != TypeProvider::contract(c));
+}
+
+BOOST_AUTO_TEST_CASE(member_lookup_on_interned_types)
+{
+	ArrayType const* storageArray = TypeProvider::array(DataLocation::Storage, TypeProvider::uint256());
+	MemberList const& members = storageArray->members(nullptr);
+	BOOST_CHECK(members.memberType("length"));
+	BOOST_CHECK_EQUAL(members.membersByName("push").size(), 2);
+	BOOST_CHECK(members.memberType("pop"));
+	// Members are only computed once for the shared object.
+	BOOST_CHECK(&TypeProvider::array(DataLocation::Storage, TypeProvider::uint256())->members(nullptr) == &members);
+	MemberList const& memoryMembers = TypeProvider::array(DataLocation::Memory, TypeProvider::uint256())->members(nullptr);
+	BOOST_CHECK(memoryMembers.memberType("length"));
+	BOOST_CHECK(memoryMembers.membersByName("push").empty());
+
+	// Members of struct types reflect the current annotations of the struct members.
+	int64_t id = 0;
+	auto member = make_shared<VariableDeclaration>(
+		++id,
+		SourceLocation{},
+		make_shared<ElementaryTypeName>(++id, SourceLocation{}, ElementaryTypeNameToken(Token::UInt, 0, 0)),
+		make_shared<string>("x"),
+		SourceLocation{},
+		nullptr,
+		Visibility::Default
+	);
+	StructDefinition s(++id, {}, make_shared<string>("Struct"), {}, {member});
+	s.annotation().recursive = false;
+	member->annotation().type = TypeProvider::uint256();
+	BOOST_CHECK(*TypeProvider::structType(s, DataLocation::Memory)->members(nullptr).memberType("x") == *TypeProvider::uint256());
+	member->annotation().type = TypeProvider::boolean();
+	BOOST_CHECK(*TypeProvider::structType(s, DataLocation::Memory)->members(nullptr).memberType("x") == *TypeProvider::boolean());
+}
+
 BOOST_AUTO_TEST_CASE(encoded_sizes)
 {
 	BOOST_CHECK_EQUAL(IntegerType(16).calldataEncodedSize(true), 32);
@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <set>
+#include <sstream>
 
 using namespace std;
 using namespace solidity::evmasm;
@@ -1252,6 +1253,71 @@ BOOST_AUTO_TEST_CASE(optimizer_settings_details_different)
 	BOOST_CHECK(optimizer["runs"].asUInt() == 600);
 }
 
+BOOST_AUTO_TEST_CASE(optimizer_settings_function_executions)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"outputSelection": {
+				"fileA": { "A": [ "metadata" ] }
+			},
+			"optimizer": { "enabled": true, "details": {
+				"yul": true,
+				"yulDetails": {
+					"functionExecutions": { "A_1_deployed": { "fun_f": 1000, "fun_g": 0 } }
+				}
+			} }
+		},
+		"sources": {
+			"fileA": {
+				"content": "contract A { }"
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	Json::Value contract = getContractResult(result, "fileA", "A");
+	BOOST_REQUIRE(contract["metadata"].isString());
+	Json::Value metadata;
+	BOOST_REQUIRE(util::jsonParseStrict(contract["metadata"].asString(), metadata));
+
+	Json::Value const& yulDetails = metadata["settings"]["optimizer"]["details"]["yulDetails"];
+	BOOST_REQUIRE(yulDetails["functionExecutions"].isObject());
+	BOOST_CHECK_EQUAL(yulDetails["functionExecutions"]["A_1_deployed"]["fun_f"].asUInt64(), 1000u);
+	BOOST_CHECK_EQUAL(yulDetails["functionExecutions"]["A_1_deployed"]["fun_g"].asUInt64(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(optimizer_settings_function_executions_invalid)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"settings": {
+			"optimizer": { "details": {
+				"yul": true,
+				"yulDetails": {
+					"functionExecutions": { "A_1_deployed": { "fun_f": -1 } }
+				}
+			} }
+		},
+		"sources": {
+			"empty": {
+				"content": ""
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsError(
+		result,
+		"JSONError",
+		"\"settings.optimizer.details.yulDetails.functionExecutions\" must be an object mapping Yul object names "
+		"to objects mapping function names to unsigned execution counts"
+	));
+}
+
 BOOST_AUTO_TEST_CASE(metadata_without_compilation)
 {
 	// NOTE: the contract code here should fail to compile due to "out of stack"
@@ -1810,6 +1876,134 @@ BOOST_AUTO_TEST_CASE(source_location_of_bare_block)
 	BOOST_REQUIRE(sourceMap.find(sourceRef) != string::npos);
 }
 
+BOOST_AUTO_TEST_CASE(phase_timings)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"A.sol": {
+				"content": "contract A { function f() public pure returns (uint) { return 42; } }"
+			}
+		},
+		"settings": {
+			"debug": { "timing": true },
+			"outputSelection": {
+				"A.sol": {
+					"A": ["evm.bytecode.object"]
+				}
+			}
+		}
+	}
+	)";
+	Json::Value result = compile(input);
+	BOOST_CHECK(containsAtMostWarnings(result));
+	BOOST_REQUIRE(result["timing"].isArray());
+
+	set<string> phases;
+	for (auto const& timing: result["timing"])
+	{
+		BOOST_REQUIRE(timing["phase"].isString());
+		BOOST_CHECK(timing["wallTimeMicroseconds"].isUInt64());
+		BOOST_CHECK(timing["cpuTimeMicroseconds"].isUInt64());
+		if (timing.isMember("peakMemoryIncrease"))
+			BOOST_CHECK(timing["peakMemoryIncrease"].isUInt64());
+		if (timing.isMember("contract"))
+			BOOST_CHECK_EQUAL(timing["contract"].asString(), "A.sol:A");
+		phases.insert(timing["phase"].asString());
+	}
+	for (string const& phase: {"parsing", "nameAndTypeResolution", "typeChecking", "evmCodegen", "evmOptimization", "evmAssembly"})
+		BOOST_CHECK_MESSAGE(phases.count(phase), "Missing phase " + phase);
+}
+
+BOOST_AUTO_TEST_CASE(streamed_output)
+{
+	char const* input = R"(
+	{
+		"language": "Solidity",
+		"sources": {
+			"A.sol": {
+				"content": "contract A { function f() public pure returns (uint) { return 42; } } contract B { uint x; }"
+			}
+		},
+		"settings": {
+			"outputSelection": {
+				"*": {
+					"*": ["abi", "evm.bytecode.object"],
+					"": ["ast"]
+				}
+			}
+		}
+	}
+	)";
+	for (util::JsonFormat const& format: {util::JsonFormat{util::JsonFormat::Compact}, util::JsonFormat{util::JsonFormat::Pretty}})
+	{
+		solidity::frontend::StandardCompiler compiler({}, format);
+		ostringstream streamed;
+		compiler.compile(input, streamed);
+		Json::Value streamedResult;
+		BOOST_REQUIRE(util::jsonParseStrict(streamed.str(), streamedResult));
+		BOOST_CHECK_EQUAL(util::jsonPrint(streamedResult, format), compiler.compile(string(input)));
+		// "errors" is written last, after "sources".
+		BOOST_CHECK_LT(streamed.str().find("\"sources\""), streamed.str().find("\"errors\""));
+	}
+}
+
+BOOST_AUTO_TEST_CASE(streamed_output_writes_sources_before_compilation_finishes)
+{
+	ostringstream streamed;
+	solidity::frontend::StandardCompiler::streamOutput(
+		[&](solidity::frontend::StandardCompiler::OutputCallback const& _output) {
+			_output({"contracts", "A.sol", "A"}, Json::objectValue);
+			_output({"errors"}, Json::arrayValue);
+			Json::Value source;
+			source["id"] = 0;
+			source["ast"]["nodeType"] = "SourceUnit";
+			_output({"sources", "A.sol"}, source);
+			// The AST is in the stream before the compilation returns, and "errors" is not.
+			BOOST_CHECK(streamed.str().find("\"SourceUnit\"") != string::npos);
+			BOOST_CHECK(streamed.str().find("\"errors\"") == string::npos);
+			_output({"sources", "B.sol"}, Json::objectValue);
+		},
+		streamed,
+		util::JsonFormat{}
+	);
+	BOOST_CHECK_EQUAL(
+		streamed.str(),
+		"{\"contracts\":{\"A.sol\":{\"A\":{}}},\"sources\":{\"A.sol\":{\"ast\":{\"nodeType\":\"SourceUnit\"},\"id\":0},\"B.sol\":{}},\"errors\":[]}"
+	);
+}
+
+BOOST_AUTO_TEST_CASE(streamed_output_exception_after_partial_output)
+{
+	ostringstream streamed;
+	solidity::frontend::StandardCompiler::streamOutput(
+		[](solidity::frontend::StandardCompiler::OutputCallback const& _output) {
+			_output({"contracts", "A.sol", "A"}, Json::objectValue);
+			Json::Value errors{Json::arrayValue};
+			errors.append(Json::objectValue);
+			errors[0]["message"] = "first";
+			_output({"errors"}, errors);
+			_output({"sources", "A.sol"}, Json::objectValue);
+			throw runtime_error("failure");
+		},
+		streamed,
+		util::JsonFormat{}
+	);
+
+	Json::Value result;
+	BOOST_REQUIRE(util::jsonParseStrict(streamed.str(), result));
+	// The members written before the exception stay.
+	BOOST_CHECK(result.getMemberNames() == (vector<string>{"contracts", "errors", "sources"}));
+	BOOST_CHECK(result["contracts"]["A.sol"].isMember("A"));
+	BOOST_CHECK(result["sources"].isMember("A.sol"));
+	BOOST_REQUIRE_EQUAL(result["errors"].size(), 2u);
+	BOOST_CHECK_EQUAL(result["errors"][0]["message"].asString(), "first");
+	BOOST_CHECK_EQUAL(result["errors"][1]["type"].asString(), "InternalCompilerError");
+	// Every key is printed only once.
+	BOOST_CHECK_EQUAL(streamed.str().find("\"errors\""), streamed.str().rfind("\"errors\""));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // end namespaces
@@ -21,11 +21,14 @@
  */
 
 #include <libsolutil/JSON.h>
+#include <libsolutil/Exceptions.h>
 
 #include <test/Common.h>
 
 #include <boost/test/unit_test.hpp>
 
+#include <sstream>
+
 using namespace std;
 
 namespace solidity::util::test
@@ -184,6 +187,65 @@ BOOST_AUTO_TEST_CASE(parse_json_strict)
 	BOOST_CHECK(json[0] == "😊");
 }
 
+BOOST_AUTO_TEST_CASE(json_stream_writer)
+{
+	Json::Value json;
+	json["a"]["b"] = 1;
+	json["a"]["c"]["d"] = Json::arrayValue;
+	json["a"]["c"]["d"].append(Json::objectValue);
+	json["a"]["c"]["d"][0]["x"] = "y";
+	json["a"]["c"]["e"] = Json::objectValue;
+	json["f"] = "g";
+
+	for (JsonFormat const& format: {JsonFormat{JsonFormat::Compact}, JsonFormat{JsonFormat::Pretty}, JsonFormat{JsonFormat::Pretty, 4}})
+	{
+		stringstream stream;
+		JsonStreamWriter writer(stream, format);
+		writer.write({"a", "b"}, json["a"]["b"]);
+		writer.write({"a", "c", "d"}, json["a"]["c"]["d"]);
+		writer.write({"a", "c", "e"}, json["a"]["c"]["e"]);
+		writer.write({"f"}, json["f"]);
+		writer.finish();
+		BOOST_CHECK_EQUAL(stream.str(), jsonPrint(json, format));
+	}
+
+	stringstream stream;
+	JsonStreamWriter writer(stream, JsonFormat{JsonFormat::Compact});
+	writer.finish();
+	BOOST_CHECK_EQUAL(stream.str(), "{}");
+
+	JsonStreamWriter unorderedWriter(stream, JsonFormat{JsonFormat::Compact});
+	unorderedWriter.write({"b"}, 1);
+	BOOST_CHECK_THROW(unorderedWriter.write({"a"}, 2), Exception);
+}
+
+BOOST_AUTO_TEST_CASE(json_stream_writer_final_member)
+{
+	for (JsonFormat const& format: {JsonFormat{JsonFormat::Compact}, JsonFormat{JsonFormat::Pretty}})
+	{
+		stringstream stream;
+		JsonStreamWriter writer(stream, format);
+		writer.write({"b", "c"}, 1);
+		writer.write({"d"}, 2);
+		writer.finish("a", Json::arrayValue);
+
+		Json::Value expectation;
+		expectation["b"]["c"] = 1;
+		expectation["d"] = 2;
+		expectation["a"] = Json::arrayValue;
+		Json::Value json;
+		BOOST_REQUIRE(jsonParseStrict(stream.str(), json));
+		BOOST_CHECK(json == expectation);
+		BOOST_CHECK_LT(stream.str().find("\"d\""), stream.str().find("\"a\""));
+		BOOST_CHECK_THROW(writer.write({"e"}, 3), Exception);
+	}
+
+	stringstream stream;
+	JsonStreamWriter writer(stream, JsonFormat{JsonFormat::Compact});
+	writer.finish("a", 1);
+	BOOST_CHECK_EQUAL(stream.str(), "{\"a\":1}");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
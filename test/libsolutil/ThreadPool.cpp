@@ -0,0 +1,94 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for the thread pool.
+ */
+
+#include <libsolutil/ThreadPool.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+
+using namespace std;
+
+namespace solidity::util::test
+{
+
+BOOST_AUTO_TEST_SUITE(ThreadPoolTest, *boost::unit_test::label("nooptions"))
+
+BOOST_AUTO_TEST_CASE(without_threads_runs_synchronously)
+{
+	ThreadPool pool(0);
+	BOOST_CHECK_EQUAL(pool.size(), 0u);
+	bool executed = false;
+	auto result = pool.submit([&]() { executed = true; return 7; });
+	BOOST_CHECK(executed);
+	BOOST_CHECK_EQUAL(result.get(), 7);
+}
+
+BOOST_AUTO_TEST_CASE(runs_all_tasks)
+{
+	ThreadPool pool(4);
+	BOOST_CHECK_EQUAL(pool.size(), 4u);
+	atomic<size_t> counter = 0;
+	vector<future<size_t>> results;
+	for (size_t i = 0; i < 100; ++i)
+		results.emplace_back(pool.submit([&counter, i]() { ++counter; return i * i; }));
+	for (size_t i = 0; i < results.size(); ++i)
+		BOOST_CHECK_EQUAL(results[i].get(), i * i);
+	BOOST_CHECK_EQUAL(counter.load(), 100u);
+}
+
+BOOST_AUTO_TEST_CASE(propagates_exceptions)
+{
+	for (size_t threads: {0u, 2u})
+	{
+		ThreadPool pool(threads);
+		auto result = pool.submit([]() -> int { throw runtime_error("failure"); });
+		BOOST_CHECK_THROW(result.get(), runtime_error);
+	}
+}
+
+BOOST_AUTO_TEST_CASE(workers_have_large_stack)
+{
+	// Uses a few megabytes of stack, which is more than the default for secondary threads on some platforms.
+	function<size_t(size_t)> recurse = [&](size_t _depth) -> size_t {
+		volatile char buffer[1024] = {};
+		return _depth == 0 ? buffer[0] : recurse(_depth - 1) + buffer[_depth % sizeof(buffer)];
+	};
+	ThreadPool pool(2);
+	BOOST_CHECK_EQUAL(pool.submit([&]() { return recurse(4000); }).get(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(destructor_waits_for_submitted_tasks)
+{
+	atomic<size_t> counter = 0;
+	{
+		ThreadPool pool(2);
+		for (size_t i = 0; i < 20; ++i)
+			pool.submit([&counter]() { ++counter; });
+	}
+	BOOST_CHECK_EQUAL(counter.load(), 20u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -208,6 +208,22 @@ BOOST_AUTO_TEST_CASE(invalid_param_rendered)
 	BOOST_CHECK_EQUAL(m.render(), templ);
 }
 
+BOOST_AUTO_TEST_CASE(unclosed_tags_rendered)
+{
+	string templ = "<?a>x<#b>y<c>";
+	BOOST_CHECK_EQUAL(Whiskers(templ)("c", "z").render(), "<?a>x<#b>yz");
+}
+
+BOOST_AUTO_TEST_CASE(template_reused)
+{
+	string templ = "<?a><b><!a>-</a>";
+	for (size_t i = 0; i < 3; ++i)
+	{
+		BOOST_CHECK_EQUAL(Whiskers(templ)("a", true)("b", to_string(i)).render(), to_string(i));
+		BOOST_CHECK_EQUAL(Whiskers(templ)("a", false)("b", to_string(i)).render(), "-");
+	}
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 }
@@ -190,6 +190,49 @@ BOOST_AUTO_TEST_CASE(to_string)
 	BOOST_CHECK_EQUAL(asmStack.print(), expectation);
 }
 
+BOOST_AUTO_TEST_CASE(replace_sub_objects)
+{
+	AssemblyStack subStack(
+		solidity::test::CommonOptions::get().evmVersion(),
+		AssemblyStack::Language::StrictAssembly,
+		solidity::frontend::OptimiserSettings::none(),
+		DebugInfoSelection::All()
+	);
+	BOOST_REQUIRE(subStack.parseAndAnalyze(
+		"sub",
+		R"(object "i" { code { sstore(0, datasize("k")) } object "k" { code {} } })"
+	));
+
+	// The placeholder does not contain "k", so the reference to "i.k" is only valid after the replacement.
+	string code = R"(
+		object "O" {
+			code { sstore(0, datasize("i.k")) }
+			object "i" { code {} }
+		}
+	)";
+	string expectation = R"(object "O" {
+	code { sstore(0, datasize("i.k")) }
+	object "i" {
+		code { sstore(0, datasize("k")) }
+		object "k" {
+			code { }
+		}
+	}
+}
+)";
+	expectation = boost::replace_all_copy(expectation, "\t", "    ");
+	AssemblyStack asmStack(
+		solidity::test::CommonOptions::get().evmVersion(),
+		AssemblyStack::Language::StrictAssembly,
+		solidity::frontend::OptimiserSettings::none(),
+		DebugInfoSelection::All()
+	);
+	BOOST_REQUIRE(asmStack.parseAndAnalyze("source", code, {{"i"_yulstring, subStack.parserResult()}}));
+	BOOST_CHECK_EQUAL(asmStack.print(), expectation);
+	// The replacement is a copy.
+	BOOST_CHECK(asmStack.parserResult()->subObjects.at(0) != subStack.parserResult());
+}
+
 BOOST_AUTO_TEST_CASE(use_src_empty)
 {
 	auto const [mapping, _] = tryGetSourceLocationMapping("");
@@ -0,0 +1,137 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for profiling the optimiser steps applied by the optimiser suite.
+ */
+
+#include <test/Common.h>
+
+#include <libyul/AssemblyStack.h>
+#include <libyul/optimiser/OptimiserProfile.h>
+
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+using namespace std;
+using namespace solidity::frontend;
+using namespace solidity::langutil;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+shared_ptr<OptimiserProfile> profile(string const& _source, OptimiserSettings _settings = OptimiserSettings::full())
+{
+	AssemblyStack stack(
+		solidity::test::CommonOptions::get().evmVersion(),
+		AssemblyStack::Language::StrictAssembly,
+		move(_settings),
+		DebugInfoSelection::Default()
+	);
+	BOOST_REQUIRE(stack.parseAndAnalyze("", _source));
+	auto result = make_shared<OptimiserProfile>();
+	stack.setOptimiserProfile(result);
+	stack.optimize();
+	return result;
+}
+
+size_t stackCompressorApplications(string const& _source)
+{
+	// Without further steps, the stack too deep errors of the source are not resolved before the stack compressor.
+	OptimiserSettings settings = OptimiserSettings::full();
+	settings.yulOptimiserSteps = "";
+	auto applications = profile(_source, move(settings))->applications();
+	return static_cast<size_t>(count_if(applications.begin(), applications.end(), [](auto const& _application) {
+		return _application.step == "StackCompressor";
+	}));
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulOptimiserProfile)
+
+BOOST_AUTO_TEST_CASE(records_step_applications)
+{
+	auto result = profile(R"({
+		function f(a) -> b { b := add(mul(a, 1), sload(a)) }
+		sstore(0, f(calldataload(0)))
+		sstore(1, f(calldataload(32)))
+	})");
+
+	auto const& applications = result->applications();
+	BOOST_REQUIRE(!applications.empty());
+	bool changedF = false;
+	for (auto const& application: applications)
+	{
+		BOOST_CHECK_EQUAL(application.object, "object");
+		// A step that changed nothing cannot have changed the code size.
+		if (application.changedFunctions.empty())
+			BOOST_CHECK_EQUAL(application.codeSizeBefore, application.codeSizeAfter);
+		auto const& changed = application.changedFunctions;
+		changedF = changedF || find(changed.begin(), changed.end(), YulString{"f"}) != changed.end();
+	}
+	BOOST_CHECK(changedF);
+}
+
+BOOST_AUTO_TEST_CASE(json_summary)
+{
+	auto result = profile("{ sstore(0, add(calldataload(0), 0)) }");
+	Json::Value json = result->toJson();
+
+	BOOST_REQUIRE(json["steps"].isArray());
+	BOOST_CHECK_EQUAL(json["steps"].size(), result->applications().size());
+	uint64_t applications = 0;
+	for (auto const& step: json["summary"].getMemberNames())
+	{
+		applications += json["summary"][step]["applications"].asUInt64();
+		BOOST_CHECK(json["summary"][step]["changes"].asUInt64() <= json["summary"][step]["applications"].asUInt64());
+	}
+	BOOST_CHECK_EQUAL(applications, result->applications().size());
+}
+
+BOOST_AUTO_TEST_CASE(stack_compressor_skipped_without_stack_too_deep_errors)
+{
+	if (!solidity::test::CommonOptions::get().evmVersion().canOverchargeGasForCall())
+		return;
+
+	BOOST_CHECK_EQUAL(stackCompressorApplications(R"({
+		function f(a) -> b { b := add(a, sload(a)) }
+		sstore(0, f(calldataload(0)))
+	})"), 0);
+
+	// The function argument is unreachable when it is stored for the first time.
+	string deepStack = "{ { mstore(0x40, memoryguard(128)) sstore(0, f(0)) } function f(a1) -> v {";
+	for (size_t i = 2; i <= 17; ++i)
+		deepStack += " let a" + to_string(i) + " := calldataload(mul(" + to_string(i) + ", 4))";
+	deepStack += " sstore(0, a1)";
+	for (size_t i = 17; i >= 2; --i)
+		deepStack += " sstore(mul(" + to_string(i) + ", 4), a" + to_string(i) + ")";
+	deepStack += " sstore(mul(1, 4), a1) } }";
+	BOOST_CHECK_EQUAL(stackCompressorApplications(deepStack), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
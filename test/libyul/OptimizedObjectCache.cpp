@@ -0,0 +1,118 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for reusing optimized sub-objects between assembly stacks.
+ */
+
+#include <test/Common.h>
+
+#include <libyul/AssemblyStack.h>
+#include <libyul/OptimizedObjectCache.h>
+
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <memory>
+#include <string>
+
+using namespace std;
+using namespace solidity::frontend;
+using namespace solidity::langutil;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+string const childObject = R"(
+	object "Child" {
+		code {
+			let size := datasize("Child_deployed")
+			datacopy(0, dataoffset("Child_deployed"), size)
+			return(0, size)
+		}
+		object "Child_deployed" {
+			code {
+				function f(a, b) -> c { c := add(mul(a, b), sload(a)) }
+				sstore(0, f(calldataload(0), calldataload(32)))
+				sstore(1, f(calldataload(64), 7))
+			}
+		}
+	}
+)";
+
+/// @returns an object named @a _name that creates "Child".
+string factoryObject(string const& _name)
+{
+	return
+		"object \"" + _name + "\" {\n"
+		"	code {\n"
+		"		let size := datasize(\"Child\")\n"
+		"		datacopy(0, dataoffset(\"Child\"), size)\n"
+		"		sstore(0, create(0, 0, size))\n"
+		"	}\n" +
+		childObject +
+		"}\n";
+}
+
+/// Optimizes @a _source twice, like the IR pipeline, and returns the printed code and bytecode.
+pair<string, bytes> compile(string const& _source, shared_ptr<OptimizedObjectCache> _cache)
+{
+	AssemblyStack stack(
+		solidity::test::CommonOptions::get().evmVersion(),
+		AssemblyStack::Language::StrictAssembly,
+		OptimiserSettings::full(),
+		DebugInfoSelection::Default(),
+		move(_cache)
+	);
+	BOOST_REQUIRE(stack.parseAndAnalyze("", _source));
+	stack.optimize();
+	stack.optimize();
+	string printed = stack.print();
+	return {printed, stack.assemble(AssemblyStack::Machine::EVM).bytecode->bytecode};
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(YulOptimizedObjectCache)
+
+BOOST_AUTO_TEST_CASE(reuse_sub_objects)
+{
+	auto cache = make_shared<OptimizedObjectCache>();
+	for (string const& name: {"FactoryA", "FactoryB"})
+	{
+		string const source = factoryObject(name);
+		auto const [printed, bytecode] = compile(source, cache);
+		auto const [expectedPrinted, expectedBytecode] = compile(source, nullptr);
+		BOOST_CHECK_EQUAL(printed, expectedPrinted);
+		BOOST_CHECK(bytecode == expectedBytecode);
+	}
+
+	BOOST_CHECK(cache->copy("Child", 0));
+	BOOST_CHECK(cache->copy("Child", 1));
+	BOOST_CHECK(cache->copy("Child_deployed", 0));
+	BOOST_CHECK(!cache->copy("Child", 2));
+	// Top-level objects are optimized as creation code and never cached.
+	BOOST_CHECK(!cache->copy("FactoryA", 0));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
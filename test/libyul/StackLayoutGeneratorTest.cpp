@@ -226,14 +226,25 @@ TestCase::TestResult StackLayoutGeneratorTest::run(ostream& _stream, string cons
 	std::ostringstream output;
 
 	std::unique_ptr<CFG> cfg = ControlFlowGraphBuilder::build(*analysisInfo, *m_dialect, *object->code);
-	StackLayout stackLayout = StackLayoutGenerator::run(*cfg);
+	auto printLayout = [&](std::ostream& _output, StackLayout const& _stackLayout) {
+		_output << "digraph CFG {\nnodesep=0.7;\nnode[shape=box];\n\n";
+		StackLayoutPrinter printer{_output, _stackLayout};
+		printer(*cfg->entry);
+		for (auto function: cfg->functions)
+			printer(cfg->functionInfo.at(function));
+		_output << "}\n";
+	};
+	printLayout(output, StackLayoutGenerator::run(*cfg, 0));
 
-	output << "digraph CFG {\nnodesep=0.7;\nnode[shape=box];\n\n";
-	StackLayoutPrinter printer{output, stackLayout};
-	printer(*cfg->entry);
-	for (auto function: cfg->functions)
-		printer(cfg->functionInfo.at(function));
-	output << "}\n";
+	// The layouts generated concurrently have to be identical to the ones generated on a single thread.
+	std::ostringstream concurrentOutput;
+	printLayout(concurrentOutput, StackLayoutGenerator::run(*cfg, 4));
+	if (concurrentOutput.str() != output.str())
+	{
+		AnsiColorized(_stream, _formatted, {formatting::BOLD, formatting::RED}) <<
+			_linePrefix << "Stack layouts generated on multiple threads differ." << endl;
+		return TestResult::FatalError;
+	}
 
 	m_obtainedResult = output.str();
 
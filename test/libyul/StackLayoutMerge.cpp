@@ -0,0 +1,118 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Unit tests for merging stack layouts along their common subsequence.
+ */
+
+#include <libyul/backends/evm/StackLayoutGenerator.h>
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+#include <vector>
+
+using namespace std;
+
+namespace solidity::yul::test
+{
+
+namespace
+{
+
+Stack literals(vector<unsigned> const& _values)
+{
+	Stack stack;
+	for (unsigned value: _values)
+		stack.emplace_back(LiteralSlot{value});
+	return stack;
+}
+
+/// @returns true if all slots of @a _subsequence occur in @a _stack in the same relative order.
+bool isSubsequence(Stack const& _subsequence, Stack const& _stack)
+{
+	auto it = _stack.begin();
+	for (StackSlot const& slot: _subsequence)
+	{
+		it = find(it, _stack.end(), slot);
+		if (it == _stack.end())
+			return false;
+		++it;
+	}
+	return true;
+}
+
+}
+
+BOOST_AUTO_TEST_SUITE(StackLayoutMerge)
+
+BOOST_AUTO_TEST_CASE(identical)
+{
+	Stack stack = literals({1, 2, 3});
+	BOOST_CHECK(StackLayoutGenerator::mergeAlongCommonSubsequence(stack, stack) == stack);
+}
+
+BOOST_AUTO_TEST_CASE(empty)
+{
+	Stack stack = literals({1, 2, 3});
+	BOOST_CHECK(StackLayoutGenerator::mergeAlongCommonSubsequence(stack, {}) == stack);
+	BOOST_CHECK(StackLayoutGenerator::mergeAlongCommonSubsequence({}, stack) == stack);
+}
+
+BOOST_AUTO_TEST_CASE(disjoint)
+{
+	Stack merged = StackLayoutGenerator::mergeAlongCommonSubsequence(literals({1, 2}), literals({3, 4}));
+	BOOST_CHECK_EQUAL(merged.size(), 4);
+	BOOST_CHECK(isSubsequence(literals({1, 2}), merged));
+	BOOST_CHECK(isSubsequence(literals({3, 4}), merged));
+}
+
+BOOST_AUTO_TEST_CASE(common_subsequence)
+{
+	// The longest common subsequence is 2, 4. The second stack also contains 1, which is kept at its
+	// position in the first stack.
+	Stack stack1 = literals({1, 2, 3, 4});
+	Stack stack2 = literals({2, 5, 4, 1});
+	Stack merged = StackLayoutGenerator::mergeAlongCommonSubsequence(stack1, stack2);
+	BOOST_CHECK(merged == literals({1, 2, 5, 3, 4}));
+	BOOST_CHECK(isSubsequence(stack1, merged));
+	BOOST_CHECK(isSubsequence(literals({2, 5, 4}), merged));
+}
+
+BOOST_AUTO_TEST_CASE(wide_stacks)
+{
+	// Reversing every other pair of slots keeps half of the second stack in order.
+	vector<unsigned> values1;
+	vector<unsigned> values2;
+	for (unsigned i = 0; i < 40; ++i)
+	{
+		values1.emplace_back(i);
+		values2.emplace_back(i % 4 < 2 ? i : (i % 4 == 2 ? i + 1 : i - 1));
+	}
+	values2.emplace_back(100);
+	Stack stack1 = literals(values1);
+	Stack stack2 = literals(values2);
+	Stack merged = StackLayoutGenerator::mergeAlongCommonSubsequence(stack1, stack2);
+	BOOST_CHECK_EQUAL(merged.size(), 41);
+	BOOST_CHECK(isSubsequence(stack1, merged));
+	for (StackSlot const& slot: stack2)
+		BOOST_CHECK_EQUAL(count(merged.begin(), merged.end(), slot), 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+}
@@ -33,6 +33,8 @@
 
 #include <libsolutil/AnsiColorized.h>
 
+#include <boost/algorithm/string.hpp>
+
 #include <fstream>
 
 using namespace solidity;
@@ -64,6 +66,23 @@ YulOptimizerTest::YulOptimizerTest(string const& _filename):
 	auto dialectName = m_reader.stringSetting("dialect", "evm");
 	m_dialect = &dialect(dialectName, solidity::test::CommonOptions::get().evmVersion());
 
+	// Comma-separated list of recorded function executions, e.g. ``f=0, g=1000``.
+	string functionExecutions = m_reader.stringSetting("functionExecutions", "");
+	if (!functionExecutions.empty())
+	{
+		vector<string> entries;
+		boost::split(entries, functionExecutions, boost::is_any_of(","));
+		for (string& entry: entries)
+		{
+			boost::trim(entry);
+			vector<string> nameAndCount;
+			boost::split(nameAndCount, entry, boost::is_any_of("="));
+			if (nameAndCount.size() != 2 || nameAndCount[0].empty() || nameAndCount[1].empty())
+				BOOST_THROW_EXCEPTION(runtime_error("Invalid function executions: \"" + entry + "\"."));
+			m_functionExecutions[YulString{nameAndCount[0]}] = stoul(nameAndCount[1]);
+		}
+	}
+
 	m_expectation = m_reader.simpleExpectations();
 }
 
@@ -78,6 +97,7 @@ TestCase::TestResult YulOptimizerTest::run(ostream& _stream, string const& _line
 	m_object->analysisInfo = m_analysisInfo;
 	YulOptimizerTestCommon tester(m_object, *m_dialect);
 	tester.setStep(m_optimizerStep);
+	tester.setFunctionExecutions(m_functionExecutions);
 
 	if (!tester.runStep())
 	{
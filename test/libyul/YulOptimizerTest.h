@@ -20,6 +20,10 @@
 
 #include <test/TestCase.h>
 
+#include <libyul/YulString.h>
+
+#include <map>
+
 namespace solidity::langutil
 {
 class Error;
@@ -53,6 +57,7 @@ private:
 	);
 
 	std::string m_optimizerStep;
+	std::map<YulString, size_t> m_functionExecutions;
 
 	Dialect const* m_dialect = nullptr;
 
@@ -168,6 +168,17 @@ YulOptimizerTestCommon::YulOptimizerTestCommon(
 			FullInliner::run(*m_context, *m_ast);
 			ExpressionJoiner::run(*m_context, *m_ast);
 		}},
+		{"gasAwareFullInliner", [&]() {
+			disambiguate();
+			FunctionHoister::run(*m_context, *m_ast);
+			FunctionGrouper::run(*m_context, *m_ast);
+			ExpressionSplitter::run(*m_context, *m_ast);
+			GasMeter meter(dynamic_cast<EVMDialect const&>(*m_dialect), false, 200);
+			m_context->inliningGasMeter = &meter;
+			FullInliner::run(*m_context, *m_ast);
+			m_context->inliningGasMeter = nullptr;
+			ExpressionJoiner::run(*m_context, *m_ast);
+		}},
 		{"mainFunction", [&]() {
 			disambiguate();
 			FunctionGrouper::run(*m_context, *m_ast);
@@ -321,6 +332,7 @@ YulOptimizerTestCommon::YulOptimizerTestCommon(
 				&meter,
 				*m_object,
 				true,
+				false,
 				frontend::OptimiserSettings::DefaultYulOptimiserSteps,
 				frontend::OptimiserSettings::standard().expectedExecutionsPerDeployment
 			);
@@ -447,4 +459,6 @@ void YulOptimizerTestCommon::updateContext()
 		m_reservedIdentifiers,
 		frontend::OptimiserSettings::standard().expectedExecutionsPerDeployment
 	});
+	if (!m_functionExecutions.empty())
+		m_context->functionExecutions = &m_functionExecutions;
 }
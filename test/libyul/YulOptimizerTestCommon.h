@@ -23,6 +23,7 @@
 
 #include <libyul/YulString.h>
 
+#include <map>
 #include <set>
 #include <memory>
 
@@ -45,6 +46,12 @@ public:
 	/// Sets optimiser step to be run to @param
 	/// _optimiserStep.
 	void setStep(std::string const& _optimizerStep);
+	/// Sets the recorded number of executions of functions, which the steps use instead of
+	/// the expected number of executions of the whole code.
+	void setFunctionExecutions(std::map<YulString, size_t> _functionExecutions)
+	{
+		m_functionExecutions = std::move(_functionExecutions);
+	}
 	/// Runs chosen optimiser step returning pointer
 	/// to yul AST Block post optimisation.
 	std::shared_ptr<Block> run();
@@ -71,6 +78,7 @@ private:
 	std::shared_ptr<Block> m_ast;
 	std::shared_ptr<AsmAnalysisInfo> m_analysisInfo;
 	std::map<std::string, std::function<void(void)>> m_namedSteps;
+	std::map<YulString, size_t> m_functionExecutions;
 };
 
 }
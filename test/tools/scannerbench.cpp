@@ -0,0 +1,139 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Micro-benchmark for the scanner: tokenizes a corpus of source files and reports throughput.
+ */
+
+#include <liblangutil/CharStream.h>
+#include <liblangutil/Scanner.h>
+
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Exceptions.h>
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::langutil;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+/// Scans all tokens of the given source and returns the number of tokens.
+size_t scan(string const& _source, ScannerKind _kind)
+{
+	CharStream stream(_source, "");
+	Scanner scanner(stream);
+	scanner.setScannerMode(_kind);
+	size_t tokens = 0;
+	for (Token token = scanner.currentToken(); token != Token::EOS; token = scanner.next())
+	{
+		++tokens;
+		// Unterminated comments and string literals consume the rest of the input.
+		if (token == Token::Illegal && stream.isPastEndOfInput())
+			break;
+	}
+	return tokens;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(scannerbench, the scanner micro-benchmark.
+Usage: scannerbench [Options] <file>...
+Tokenizes all given files repeatedly and prints the scanner throughput.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		("yul", "Scan the input as Yul instead of Solidity.")
+		("repeat", po::value<size_t>()->default_value(10), "Number of times the corpus is scanned.")
+		("input-file", po::value<vector<string>>(), "input file");
+	po::positional_options_description filesPositions;
+	filesPositions.add("input-file", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help") || !arguments.count("input-file"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	vector<string> corpus;
+	size_t corpusSize = 0;
+	for (string const& path: arguments["input-file"].as<vector<string>>())
+	{
+		try
+		{
+			corpus.emplace_back(readFileAsString(path));
+			corpusSize += corpus.back().size();
+		}
+		catch (FileNotFound const&)
+		{
+			cerr << "File not found: " << path << endl;
+			return 1;
+		}
+		catch (NotAFile const&)
+		{
+			cerr << "Not a regular file: " << path << endl;
+			return 1;
+		}
+	}
+
+	ScannerKind kind = arguments.count("yul") ? ScannerKind::Yul : ScannerKind::Solidity;
+	size_t repeat = max<size_t>(arguments["repeat"].as<size_t>(), 1);
+	size_t tokens = 0;
+	auto start = chrono::steady_clock::now();
+	for (size_t i = 0; i < repeat; ++i)
+		for (string const& source: corpus)
+			tokens += scan(source, kind);
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+	double megabytes = static_cast<double>(corpusSize * repeat) / 1e6;
+	cout << "Files:      " << corpus.size() << endl;
+	cout << "Bytes:      " << corpusSize << endl;
+	cout << "Tokens:     " << tokens / repeat << endl;
+	cout << "Time:       " << elapsed.count() / static_cast<double>(repeat) * 1000 << " ms per iteration" << endl;
+	cout << "Throughput: " << megabytes / elapsed.count() << " MB/s" << endl;
+
+	return 0;
+}
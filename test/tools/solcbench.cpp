@@ -0,0 +1,560 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Compile-time benchmark: compiles a corpus of projects and synthetic stress contracts with
+ * the legacy and the IR pipeline, reports the time and memory usage of the compiler and
+ * compares them against a stored baseline.
+ * Where supported, every case is compiled in a child process, so that its peak memory usage
+ * is not affected by the cases compiled before.
+ */
+
+#include <libsolidity/interface/CompilerStack.h>
+#include <libsolidity/interface/OptimiserSettings.h>
+#include <libsolidity/interface/Version.h>
+
+#include <liblangutil/Exceptions.h>
+#include <liblangutil/SourceReferenceFormatter.h>
+
+#include <libsolutil/CommonData.h>
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Exceptions.h>
+#include <libsolutil/JSON.h>
+#include <libsolutil/PhaseTimer.h>
+
+#include <boost/exception/diagnostic_information.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::langutil;
+using namespace solidity::frontend;
+
+namespace po = boost::program_options;
+namespace fs = boost::filesystem;
+
+namespace
+{
+
+struct BenchmarkCase
+{
+	string name;
+	StringMap sources;
+};
+
+struct BenchmarkResult
+{
+	/// Error message if the case could not be compiled.
+	optional<string> error;
+	/// Times of the fastest repetition.
+	chrono::microseconds wallTime{};
+	chrono::microseconds cpuTime{};
+	/// Total time per phase of the fastest repetition.
+	map<string, chrono::microseconds> phases;
+	/// Peak resident set size in bytes of the child process that compiled the case, if the case
+	/// was compiled in a child process. Includes the memory of the benchmark itself at the time
+	/// of the fork, which does not depend on the case.
+	optional<size_t> peakMemory;
+};
+
+string const licenseAndPragma = "// SPDX-License-Identifier: GPL-3.0\npragma solidity >=0.0;\n";
+
+/// A contract with many independent public functions.
+string manyFunctions(size_t _count)
+{
+	string source = licenseAndPragma + "contract ManyFunctions {\n\tmapping(uint => uint) data;\n";
+	for (size_t i = 0; i < _count; ++i)
+	{
+		string index = to_string(i);
+		source +=
+			"\tfunction f" + index + "(uint a, uint b) public returns (uint) {\n"
+			"\t\tuint c = a * " + to_string(i + 1) + " + b;\n"
+			"\t\tif (c > data[a]) data[a] = c; else data[b] = c / (b + 1);\n"
+			"\t\treturn c ^ data[" + index + "];\n"
+			"\t}\n";
+	}
+	return source + "}\n";
+}
+
+/// A long chain of contracts overriding the same function.
+string deepInheritance(size_t _depth)
+{
+	string source = licenseAndPragma +
+		"contract Base0 {\n"
+		"\tuint internal v0;\n"
+		"\tfunction g() public virtual returns (uint) { v0 += 1; return v0; }\n"
+		"}\n";
+	for (size_t i = 1; i < _depth; ++i)
+	{
+		string index = to_string(i);
+		source +=
+			"contract Base" + index + " is Base" + to_string(i - 1) + " {\n"
+			"\tuint internal v" + index + ";\n"
+			"\tfunction g() public virtual override returns (uint) { return super.g() + v" + index + "; }\n"
+			"\tfunction h" + index + "(uint x) public { v" + index + " = x; }\n"
+			"}\n";
+	}
+	return source;
+}
+
+/// A chain of contracts each creating the previous one, so that their code is nested.
+string nestedCreation(size_t _depth)
+{
+	string source = licenseAndPragma +
+		"contract Created0 {\n"
+		"\tuint public x;\n"
+		"\tconstructor(uint _x) { x = _x; }\n"
+		"}\n";
+	for (size_t i = 1; i < _depth; ++i)
+	{
+		string index = to_string(i);
+		string previous = to_string(i - 1);
+		source +=
+			"contract Created" + index + " {\n"
+			"\tCreated" + previous + " public child;\n"
+			"\tconstructor(uint _x) { child = new Created" + previous + "(_x + 1); }\n"
+			"\tfunction renew(uint _x) public { child = new Created" + previous + "(_x); }\n"
+			"}\n";
+	}
+	return source;
+}
+
+/// Nested structs with dynamic members that are encoded and decoded.
+string abiCoding(size_t _depth)
+{
+	string source = licenseAndPragma +
+		"contract AbiCoding {\n"
+		"\tstruct S0 { uint a; bytes b; uint[] c; }\n";
+	for (size_t i = 1; i < _depth; ++i)
+		source += "\tstruct S" + to_string(i) + " { S" + to_string(i - 1) + " inner; uint[] values; string name; }\n";
+	for (size_t i = 0; i < _depth; ++i)
+	{
+		string type = "S" + to_string(i);
+		source +=
+			"\tfunction e" + to_string(i) + "(" + type + " memory s) public pure returns (bytes memory) { return abi.encode(s); }\n"
+			"\tfunction d" + to_string(i) + "(bytes memory b) public pure returns (" + type + " memory) { return abi.decode(b, (" + type + ")); }\n";
+	}
+	return source + "}\n";
+}
+
+vector<BenchmarkCase> syntheticCases()
+{
+	return {
+		{"synthetic/manyFunctions", {{"ManyFunctions.sol", manyFunctions(200)}}},
+		{"synthetic/deepInheritance", {{"DeepInheritance.sol", deepInheritance(30)}}},
+		{"synthetic/nestedCreation", {{"NestedCreation.sol", nestedCreation(12)}}},
+		{"synthetic/abiCoding", {{"AbiCoding.sol", abiCoding(6)}}}
+	};
+}
+
+/// @returns a case containing all Solidity files below @a _path, named relative to it,
+/// or just the file at @a _path.
+BenchmarkCase loadCase(fs::path const& _path)
+{
+	BenchmarkCase benchmarkCase{_path.filename().string(), {}};
+	if (fs::is_directory(_path))
+	{
+		for (fs::directory_entry const& entry: fs::recursive_directory_iterator(_path))
+			if (fs::is_regular_file(entry.path()) && entry.path().extension() == ".sol")
+				benchmarkCase.sources[fs::relative(entry.path(), _path).generic_string()] = readFileAsString(entry.path());
+	}
+	else
+		benchmarkCase.sources[_path.filename().generic_string()] = readFileAsString(_path);
+	return benchmarkCase;
+}
+
+BenchmarkResult run(BenchmarkCase const& _case, bool _viaIR, bool _optimize, size_t _repeat)
+{
+	BenchmarkResult result;
+	for (size_t i = 0; i < _repeat; ++i)
+	{
+		CompilerStack compiler;
+		compiler.setSources(_case.sources);
+		compiler.setViaIR(_viaIR);
+		compiler.setOptimiserSettings(_optimize ? OptimiserSettings::standard() : OptimiserSettings::minimal());
+		compiler.enablePhaseTimings();
+
+		clock_t cpuStart = clock();
+		auto start = chrono::steady_clock::now();
+		try
+		{
+			if (!compiler.compile())
+			{
+				for (auto const& error: compiler.errors())
+					if (Error::isError(error->type()))
+					{
+						result.error = SourceReferenceFormatter::formatErrorInformation(*error, compiler);
+						break;
+					}
+				if (!result.error)
+					result.error = "Compilation failed.";
+			}
+		}
+		catch (...)
+		{
+			result.error = boost::current_exception_diagnostic_information();
+		}
+		if (result.error)
+			return result;
+		auto wallTime = chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start);
+		auto cpuTime = chrono::microseconds(static_cast<int64_t>(
+			static_cast<double>(clock() - cpuStart) * 1e6 / static_cast<double>(CLOCKS_PER_SEC)
+		));
+
+		if (i == 0 || wallTime < result.wallTime)
+		{
+			result.wallTime = wallTime;
+			result.cpuTime = cpuTime;
+			result.phases.clear();
+			for (PhaseTiming const& timing: compiler.phaseTimings())
+				result.phases[timing.phase] += timing.wallTime;
+		}
+	}
+	return result;
+}
+
+Json::Value toJson(BenchmarkResult const& _result)
+{
+	Json::Value benchmarkCase{Json::objectValue};
+	if (_result.error)
+	{
+		benchmarkCase["error"] = *_result.error;
+		return benchmarkCase;
+	}
+	benchmarkCase["wallTimeMicroseconds"] = Json::Int64(_result.wallTime.count());
+	benchmarkCase["cpuTimeMicroseconds"] = Json::Int64(_result.cpuTime.count());
+	if (_result.peakMemory)
+		benchmarkCase["peakMemory"] = Json::UInt64(*_result.peakMemory);
+	benchmarkCase["phases"] = Json::objectValue;
+	for (auto const& [phase, time]: _result.phases)
+		benchmarkCase["phases"][phase] = Json::Int64(time.count());
+	return benchmarkCase;
+}
+
+BenchmarkResult resultFromJson(Json::Value const& _benchmarkCase)
+{
+	BenchmarkResult result;
+	if (_benchmarkCase.isMember("error"))
+	{
+		result.error = _benchmarkCase["error"].asString();
+		return result;
+	}
+	result.wallTime = chrono::microseconds(_benchmarkCase["wallTimeMicroseconds"].asInt64());
+	result.cpuTime = chrono::microseconds(_benchmarkCase["cpuTimeMicroseconds"].asInt64());
+	if (_benchmarkCase.isMember("peakMemory"))
+		result.peakMemory = static_cast<size_t>(_benchmarkCase["peakMemory"].asUInt64());
+	for (string const& phase: _benchmarkCase["phases"].getMemberNames())
+		result.phases[phase] = chrono::microseconds(_benchmarkCase["phases"][phase].asInt64());
+	return result;
+}
+
+/// Runs @a _case in a child process and measures the peak memory usage of that process.
+/// Runs it in this process without measuring the memory usage if the platform does not support that.
+BenchmarkResult runInChildProcess(BenchmarkCase const& _case, bool _viaIR, bool _optimize, size_t _repeat)
+{
+#if defined(__linux__) || defined(__APPLE__)
+	BenchmarkResult failure;
+	int fds[2];
+	if (pipe(fds) != 0)
+	{
+		failure.error = "Could not create a pipe to the compiler process.";
+		return failure;
+	}
+	// Buffered output would otherwise be written by both processes.
+	cout.flush();
+	cerr.flush();
+	pid_t pid = fork();
+	if (pid < 0)
+	{
+		close(fds[0]);
+		close(fds[1]);
+		failure.error = "Could not start the compiler process.";
+		return failure;
+	}
+	if (pid == 0)
+	{
+		close(fds[0]);
+		string data = jsonCompactPrint(toJson(run(_case, _viaIR, _optimize, _repeat)));
+		for (size_t written = 0; written < data.size();)
+		{
+			ssize_t count = write(fds[1], data.data() + written, data.size() - written);
+			if (count < 0 && errno == EINTR)
+				continue;
+			if (count <= 0)
+				_exit(1);
+			written += static_cast<size_t>(count);
+		}
+		_exit(0);
+	}
+
+	close(fds[1]);
+	string data;
+	char buffer[4096];
+	while (true)
+	{
+		ssize_t count = read(fds[0], buffer, sizeof(buffer));
+		if (count < 0 && errno == EINTR)
+			continue;
+		if (count <= 0)
+			break;
+		data.append(buffer, static_cast<size_t>(count));
+	}
+	close(fds[0]);
+
+	int status = 0;
+	rusage usage{};
+	pid_t waited = 0;
+	do
+		waited = wait4(pid, &status, 0, &usage);
+	while (waited < 0 && errno == EINTR);
+	Json::Value benchmarkCase;
+	if (waited != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0 || !jsonParseStrict(data, benchmarkCase))
+	{
+		failure.error = "The compiler process terminated abnormally.";
+		return failure;
+	}
+	BenchmarkResult result = resultFromJson(benchmarkCase);
+	if (!result.error)
+#if defined(__APPLE__)
+		result.peakMemory = static_cast<size_t>(usage.ru_maxrss);
+#else
+		// Linux reports kilobytes.
+		result.peakMemory = static_cast<size_t>(usage.ru_maxrss) * 1024;
+#endif
+	return result;
+#else
+	return run(_case, _viaIR, _optimize, _repeat);
+#endif
+}
+
+Json::Value toJson(map<string, BenchmarkResult> const& _results)
+{
+	Json::Value cases{Json::objectValue};
+	for (auto const& [name, result]: _results)
+		cases[name] = toJson(result);
+
+	Json::Value output{Json::objectValue};
+	output["version"] = VersionString;
+	output["cases"] = move(cases);
+	return output;
+}
+
+double milliseconds(chrono::microseconds _time)
+{
+	return static_cast<double>(_time.count()) / 1000.0;
+}
+
+void print(string const& _name, BenchmarkResult const& _result)
+{
+	cout << left << setw(45) << _name << right;
+	if (_result.error)
+	{
+		cout << " failed" << endl;
+		return;
+	}
+	cout << fixed << setprecision(1);
+	cout << setw(12) << milliseconds(_result.wallTime) << " ms wall";
+	cout << setw(12) << milliseconds(_result.cpuTime) << " ms cpu";
+	if (_result.peakMemory)
+		cout << setw(10) << static_cast<double>(*_result.peakMemory) / (1024 * 1024) << " MiB peak";
+	cout << defaultfloat << endl;
+}
+
+/// Compares the wall time and, if measured in both, the peak memory usage of all cases in @a _baseline
+/// to @a _current.
+/// @returns the number of regressions, which are printed to stderr.
+size_t compare(Json::Value const& _baseline, Json::Value const& _current, double _tolerance)
+{
+	auto exceeds = [&](string const& _case, string const& _what, Json::Value const& _base, Json::Value const& _value) {
+		double base = _base.asDouble();
+		double value = _value.asDouble();
+		if (base <= 0 || value <= base * (1.0 + _tolerance / 100.0))
+			return false;
+		cerr << "Regression in " << _case << ": " << _what << " " << value << " vs. " << base << " in the baseline ";
+		cerr << "(+" << fixed << setprecision(1) << (value / base - 1.0) * 100.0 << defaultfloat << "%)" << endl;
+		return true;
+	};
+
+	size_t regressions = 0;
+	for (string const& name: _baseline["cases"].getMemberNames())
+	{
+		Json::Value const& base = _baseline["cases"][name];
+		Json::Value const& current = _current["cases"][name];
+		if (!current.isObject())
+			cerr << "Case " << name << " of the baseline was not run." << endl;
+		else if (current.isMember("error") && !base.isMember("error"))
+		{
+			cerr << "Regression in " << name << ": compilation failed." << endl;
+			++regressions;
+		}
+		else if (!current.isMember("error") && !base.isMember("error"))
+		{
+			if (exceeds(name, "wall time (us)", base["wallTimeMicroseconds"], current["wallTimeMicroseconds"]))
+				++regressions;
+			if (
+				base.isMember("peakMemory") &&
+				current.isMember("peakMemory") &&
+				exceeds(name, "peak memory (bytes)", base["peakMemory"], current["peakMemory"])
+			)
+				++regressions;
+		}
+	}
+	return regressions;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(solcbench, the compile-time benchmark.
+Usage: solcbench [Options] <project>...
+Compiles every given project (a directory whose Solidity files are compiled together, or a
+single file) and a set of synthetic stress contracts with the legacy and the IR pipeline.
+Every case is compiled in a separate process. Prints the wall time, processor time and peak
+memory usage of the compiler for each of them and optionally compares them against a baseline
+written by an earlier run. The peak memory usage is only measured on Linux and macOS.
+The contracts in test/compilationTests can be used as projects.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		("repeat", po::value<size_t>()->default_value(3), "Number of compilations per case, the fastest one is reported.")
+		("pipeline", po::value<string>()->default_value("both"), "Pipeline to benchmark: legacy, via-ir or both.")
+		("no-optimize", "Disable the optimizer.")
+		("no-synthetic", "Do not compile the synthetic stress contracts.")
+		("output", po::value<string>(), "Write the results as JSON to the given file, e.g. to be used as a baseline.")
+		("baseline", po::value<string>(), "Compare the results against the given baseline file.")
+		("tolerance", po::value<double>()->default_value(10.0), "Allowed increase over the baseline in percent.")
+		("input-file", po::value<vector<string>>(), "input file");
+	po::positional_options_description filesPositions;
+	filesPositions.add("input-file", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	vector<pair<string, bool>> pipelines;
+	string pipeline = arguments["pipeline"].as<string>();
+	if (pipeline == "legacy" || pipeline == "both")
+		pipelines.emplace_back("legacy", false);
+	if (pipeline == "via-ir" || pipeline == "both")
+		pipelines.emplace_back("via-ir", true);
+	if (pipelines.empty())
+	{
+		cerr << "Invalid pipeline: " << pipeline << endl;
+		return 1;
+	}
+
+	vector<BenchmarkCase> cases;
+	if (arguments.count("input-file"))
+		for (string const& path: arguments["input-file"].as<vector<string>>())
+		{
+			if (!fs::exists(path))
+			{
+				cerr << "File not found: " << path << endl;
+				return 1;
+			}
+			cases.emplace_back(loadCase(path));
+		}
+	if (!arguments.count("no-synthetic"))
+		cases += syntheticCases();
+	if (cases.empty())
+	{
+		cout << options;
+		return 1;
+	}
+
+	optional<Json::Value> baseline;
+	if (arguments.count("baseline"))
+	{
+		string const path = arguments["baseline"].as<string>();
+		string errors;
+		baseline.emplace();
+		if (!fs::is_regular_file(path) || !jsonParseStrict(readFileAsString(path), *baseline, &errors))
+		{
+			cerr << "Invalid baseline " << path << ": " << errors << endl;
+			return 1;
+		}
+	}
+
+	bool const optimize = !arguments.count("no-optimize");
+	size_t const repeat = max<size_t>(arguments["repeat"].as<size_t>(), 1);
+	map<string, BenchmarkResult> results;
+	for (BenchmarkCase const& benchmarkCase: cases)
+		for (auto const& [pipelineName, viaIR]: pipelines)
+		{
+			string name = benchmarkCase.name + "/" + pipelineName;
+			BenchmarkResult const& result = results[name] = runInChildProcess(benchmarkCase, viaIR, optimize, repeat);
+			print(name, result);
+			if (result.error)
+				cerr << *result.error << endl;
+		}
+
+	Json::Value output = toJson(results);
+	if (arguments.count("output"))
+	{
+		ofstream outputFile(arguments["output"].as<string>());
+		outputFile << jsonPrettyPrint(output) << endl;
+		if (!outputFile)
+		{
+			cerr << "Could not write " << arguments["output"].as<string>() << endl;
+			return 1;
+		}
+	}
+
+	if (baseline && compare(*baseline, output, arguments["tolerance"].as<double>()) > 0)
+		return 2;
+
+	return 0;
+}
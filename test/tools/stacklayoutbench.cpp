@@ -0,0 +1,270 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Benchmark for the stack layout generator: generates the stack layouts of the control flow graphs
+ * of Yul objects (e.g. the output of ``solc --ir-optimized``) and reports the time it takes and the
+ * number of stack shuffling operations the layouts require.
+ */
+
+#include <libyul/AssemblyStack.h>
+#include <libyul/Object.h>
+#include <libyul/backends/evm/ControlFlowGraphBuilder.h>
+#include <libyul/backends/evm/EVMDialect.h>
+#include <libyul/backends/evm/StackHelpers.h>
+#include <libyul/backends/evm/StackLayoutGenerator.h>
+
+#include <liblangutil/EVMVersion.h>
+#include <liblangutil/SourceReferenceFormatter.h>
+
+#include <libsolidity/interface/OptimiserSettings.h>
+
+#include <libsolutil/Algorithms.h>
+#include <libsolutil/CommonIO.h>
+#include <libsolutil/Exceptions.h>
+#include <libsolutil/Visitor.h>
+
+#include <boost/program_options.hpp>
+
+#include <range/v3/view/reverse.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+using namespace solidity::langutil;
+using namespace solidity::yul;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+/// Stack shuffling operations required to reach the generated layouts.
+struct ShuffleCost
+{
+	size_t swaps = 0;
+	size_t pushesOrDups = 0;
+	size_t pops = 0;
+	/// Swaps and dups that reach deeper than 16 slots, i.e. stack too deep errors.
+	size_t unreachable = 0;
+
+	ShuffleCost& operator+=(ShuffleCost const& _other)
+	{
+		swaps += _other.swaps;
+		pushesOrDups += _other.pushesOrDups;
+		pops += _other.pops;
+		unreachable += _other.unreachable;
+		return *this;
+	}
+};
+
+/// Replays the shuffling the code transform performs with @a _layout, starting at @a _entry.
+ShuffleCost shuffleCost(StackLayout const& _layout, CFG::BasicBlock const& _entry)
+{
+	ShuffleCost cost;
+	auto shuffle = [&](Stack& _current, Stack const& _target) {
+		createStackLayout(
+			_current,
+			_target,
+			[&](unsigned _swapDepth) {
+				++cost.swaps;
+				if (_swapDepth > 16)
+					++cost.unreachable;
+			},
+			[&](StackSlot const& _slot) {
+				++cost.pushesOrDups;
+				if (canBeFreelyGenerated(_slot))
+					return;
+				auto depth = util::findOffset(_current | ranges::views::reverse, _slot);
+				if (depth && *depth >= 16)
+					++cost.unreachable;
+			},
+			[&]() { ++cost.pops; }
+		);
+	};
+
+	util::BreadthFirstSearch<CFG::BasicBlock const*> breadthFirstSearch{{&_entry}};
+	breadthFirstSearch.run([&](CFG::BasicBlock const* _block, auto _addChild) {
+		StackLayout::BlockInfo const& info = _layout.blockInfos.at(_block);
+		Stack currentStack = info.entryLayout;
+		for (auto const& operation: _block->operations)
+		{
+			shuffle(currentStack, _layout.operationEntryLayout.at(&operation));
+			for (size_t i = 0; i < operation.input.size(); i++)
+				currentStack.pop_back();
+			currentStack += operation.output;
+		}
+		std::visit(util::GenericVisitor{
+			[&](CFG::BasicBlock::MainExit const&) {},
+			[&](CFG::BasicBlock::Jump const& _jump)
+			{
+				shuffle(currentStack, _layout.blockInfos.at(_jump.target).entryLayout);
+				if (!_jump.backwards)
+					_addChild(_jump.target);
+			},
+			[&](CFG::BasicBlock::ConditionalJump const& _conditionalJump)
+			{
+				shuffle(currentStack, info.exitLayout);
+				_addChild(_conditionalJump.zero);
+				_addChild(_conditionalJump.nonZero);
+			},
+			[&](CFG::BasicBlock::FunctionReturn const&) { shuffle(currentStack, info.exitLayout); },
+			[&](CFG::BasicBlock::Terminated const&) {},
+		}, _block->exit);
+	});
+	return cost;
+}
+
+struct Result
+{
+	size_t graphs = 0;
+	size_t functions = 0;
+	double milliseconds = 0;
+	ShuffleCost cost;
+};
+
+/// Generates the layouts of @a _object and all its sub-objects @a _repeat times.
+void measure(Object const& _object, Dialect const& _dialect, size_t _repeat, Result& _result)
+{
+	solAssert(_object.code && _object.analysisInfo, "");
+	unique_ptr<CFG> cfg = ControlFlowGraphBuilder::build(*_object.analysisInfo, _dialect, *_object.code);
+	auto start = chrono::steady_clock::now();
+	StackLayout layout = StackLayoutGenerator::run(*cfg);
+	for (size_t i = 1; i < _repeat; ++i)
+		layout = StackLayoutGenerator::run(*cfg);
+	chrono::duration<double, milli> elapsed = chrono::steady_clock::now() - start;
+
+	++_result.graphs;
+	_result.functions += cfg->functions.size();
+	_result.milliseconds += elapsed.count() / static_cast<double>(_repeat);
+	_result.cost += shuffleCost(layout, *cfg->entry);
+	for (Scope::Function const* function: cfg->functions)
+		_result.cost += shuffleCost(layout, *cfg->functionInfo.at(function).entry);
+
+	for (auto const& subNode: _object.subObjects)
+		if (auto const* subObject = dynamic_cast<Object const*>(subNode.get()))
+			measure(*subObject, _dialect, _repeat, _result);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(stacklayoutbench, the stack layout generator benchmark.
+Usage: stacklayoutbench [Options] <file>...
+Generates the stack layouts of all Yul objects in the given files repeatedly and prints
+the time per iteration and the stack shuffling operations the layouts require.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		("optimize", "Run the Yul optimizer before generating the layouts.")
+		("repeat", po::value<size_t>()->default_value(10), "Number of times the layouts are generated.")
+		("input-file", po::value<vector<string>>(), "input file");
+	po::positional_options_description filesPositions;
+	filesPositions.add("input-file", -1);
+
+	po::variables_map arguments;
+	try
+	{
+		po::command_line_parser cmdLineParser(argc, argv);
+		cmdLineParser.options(options).positional(filesPositions);
+		po::store(cmdLineParser.run(), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help") || !arguments.count("input-file"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	EVMVersion const evmVersion;
+	Dialect const& dialect = EVMDialect::strictAssemblyForEVMObjects(evmVersion);
+	size_t repeat = max<size_t>(arguments["repeat"].as<size_t>(), 1);
+	Result total;
+	for (string const& path: arguments["input-file"].as<vector<string>>())
+	{
+		string source;
+		try
+		{
+			source = readFileAsString(path);
+		}
+		catch (FileNotFound const&)
+		{
+			cerr << "File not found: " << path << endl;
+			return 1;
+		}
+		catch (NotAFile const&)
+		{
+			cerr << "Not a regular file: " << path << endl;
+			return 1;
+		}
+
+		AssemblyStack stack(
+			evmVersion,
+			AssemblyStack::Language::StrictAssembly,
+			arguments.count("optimize") ?
+				frontend::OptimiserSettings::full() :
+				frontend::OptimiserSettings::minimal(),
+			DebugInfoSelection::Default()
+		);
+		if (!stack.parseAndAnalyze(path, source))
+		{
+			for (auto const& error: stack.errors())
+				SourceReferenceFormatter{cerr, stack, false, false}.printErrorInformation(*error);
+			return 1;
+		}
+		stack.optimize();
+
+		Result result;
+		measure(*stack.parserResult(), dialect, repeat, result);
+		cout << path << ": " << result.milliseconds << " ms, " <<
+			result.cost.swaps << " swaps, " <<
+			result.cost.pushesOrDups << " pushes or dups, " <<
+			result.cost.pops << " pops, " <<
+			result.cost.unreachable << " unreachable" << endl;
+
+		total.graphs += result.graphs;
+		total.functions += result.functions;
+		total.milliseconds += result.milliseconds;
+		total.cost += result.cost;
+	}
+
+	cout << "Graphs:      " << total.graphs << endl;
+	cout << "Functions:   " << total.functions << endl;
+	cout << "Time:        " << total.milliseconds << " ms per iteration" << endl;
+	cout << "Swaps:       " << total.cost.swaps << endl;
+	cout << "Pushes/dups: " << total.cost.pushesOrDups << endl;
+	cout << "Pops:        " << total.cost.pops << endl;
+	cout << "Unreachable: " << total.cost.unreachable << endl;
+
+	return 0;
+}
@@ -0,0 +1,132 @@
+/*
+	This file is part of solidity.
+
+	solidity is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation, either version 3 of the License, or
+	(at your option) any later version.
+
+	solidity is distributed in the hope that it will be useful,
+	but WITHOUT ANY WARRANTY; without even the implied warranty of
+	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+	GNU General Public License for more details.
+
+	You should have received a copy of the GNU General Public License
+	along with solidity.  If not, see <http://www.gnu.org/licenses/>.
+*/
+// SPDX-License-Identifier: GPL-3.0
+/**
+ * Micro-benchmark for the template engine: renders templates shaped like the ones used by
+ * the IR code generator and reports the render throughput.
+ */
+
+#include <libsolutil/Whiskers.h>
+
+#include <boost/program_options.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace solidity;
+using namespace solidity::util;
+
+namespace po = boost::program_options;
+
+namespace
+{
+
+/// Renders a utility function with a parameter list, returns the size of the result.
+size_t renderFunction(size_t _index)
+{
+	vector<Whiskers::StringMap> parameters(_index % 4);
+	for (size_t i = 0; i < parameters.size(); ++i)
+		parameters[i]["slot"] = "slot_" + to_string(i);
+	return Whiskers(R"(
+		function <functionName>(headStart <#params>, <slot></params>) -> tail {
+			tail := add(headStart, <headSize>)
+			<#params>
+			<?dynamic>
+				mstore(add(headStart, 0x20), sub(tail, headStart))
+				tail := <abiEncode>(<slot>, tail)
+			<!dynamic>
+				<abiEncode>(<slot>, add(headStart, 0x20))
+			</dynamic>
+			</params>
+			<?+revertString> revert(0, <revertString>) </+revertString>
+		}
+	)")
+	("functionName", "abi_encode_tuple_" + to_string(_index))
+	("headSize", to_string(32 * parameters.size()))
+	("params", parameters)
+	("dynamic", _index % 2 == 0)
+	("abiEncode", "abi_encode_t_uint256_to_t_uint256")
+	("revertString", _index % 3 == 0 ? "" : "0x20")
+	.render().size();
+}
+
+/// Renders a short cleanup function, returns the size of the result.
+size_t renderCleanup(size_t _index)
+{
+	return Whiskers(R"(
+		function <functionName>(value) -> cleaned {
+			cleaned := <?signed>signextend(<bytes>, value)<!signed>and(value, <mask>)</signed>
+		}
+	)")
+	("functionName", "cleanup_t_uint" + to_string(8 * (_index % 32 + 1)))
+	("signed", _index % 2 == 1)
+	("bytes", to_string(_index % 32))
+	("mask", "0xffffffffffffffffffffffffffffffffffffffff")
+	.render().size();
+}
+
+}
+
+int main(int argc, char** argv)
+{
+	po::options_description options(
+		R"(whiskersbench, the template engine micro-benchmark.
+Usage: whiskersbench [Options]
+Renders templates repeatedly and prints the render throughput.
+
+Allowed options)",
+		po::options_description::m_default_line_length,
+		po::options_description::m_default_line_length - 23);
+	options.add_options()
+		("help", "Show this help screen.")
+		("repeat", po::value<size_t>()->default_value(100000), "Number of times each template is rendered.");
+
+	po::variables_map arguments;
+	try
+	{
+		po::store(po::parse_command_line(argc, argv, options), arguments);
+	}
+	catch (po::error const& _exception)
+	{
+		cerr << _exception.what() << endl;
+		return 1;
+	}
+
+	if (arguments.count("help"))
+	{
+		cout << options;
+		return 0;
+	}
+
+	size_t repeat = max<size_t>(arguments["repeat"].as<size_t>(), 1);
+	size_t bytes = 0;
+	auto start = chrono::steady_clock::now();
+	for (size_t i = 0; i < repeat; ++i)
+		bytes += renderFunction(i) + renderCleanup(i);
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+	double renders = static_cast<double>(2 * repeat);
+	cout << "Renders:    " << 2 * repeat << endl;
+	cout << "Bytes:      " << bytes << endl;
+	cout << "Time:       " << elapsed.count() * 1000 << " ms" << endl;
+	cout << "Throughput: " << renders / elapsed.count() << " renders/s" << endl;
+
+	return 0;
+}
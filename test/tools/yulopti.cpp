@@ -32,6 +32,7 @@
 #include <liblangutil/SourceReferenceFormatter.h>
 
 #include <libyul/optimiser/Disambiguator.h>
+#include <libyul/optimiser/OptimiserProfile.h>
 #include <libyul/optimiser/OptimiserStep.h>
 #include <libyul/optimiser/StackCompressor.h>
 #include <libyul/optimiser/VarNameCleaner.h>
@@ -177,12 +178,22 @@ public:
 		m_nameDispenser.reset(*m_ast);
 	}
 
-	void runSteps(string _source, string _steps)
+	void runSteps(string _source, string _steps, bool _profile = false)
 	{
 		parse(_source);
 		disambiguate();
-		OptimiserSuite{m_context}.runSequence(_steps, *m_ast);
-		cout << AsmPrinter{m_dialect}(*m_ast) << endl;
+		if (_profile)
+		{
+			OptimiserProfile profile;
+			OptimiserSuite{m_context, OptimiserSuite::Debug::None, &profile}.runSequence(_steps, *m_ast);
+			cout << AsmPrinter{m_dialect}(*m_ast) << endl;
+			cout << jsonPrettyPrint(profile.toJson()) << endl;
+		}
+		else
+		{
+			OptimiserSuite{m_context}.runSequence(_steps, *m_ast);
+			cout << AsmPrinter{m_dialect}(*m_ast) << endl;
+		}
 	}
 
 	void runInteractive(string _source, bool _disambiguated = false)
@@ -261,6 +272,7 @@ int main(int argc, char** argv)
 	try
 	{
 		bool nonInteractive = false;
+		bool profile = false;
 		po::options_description options(
 			R"(yulopti, yul optimizer exploration tool.
 	Usage: yulopti [Options] <file>
@@ -288,6 +300,11 @@ int main(int argc, char** argv)
 				po::bool_switch(&nonInteractive)->default_value(false),
 				"stop after executing the provided steps"
 			)
+			(
+				"profile",
+				po::bool_switch(&profile)->default_value(false),
+				"print the run time, code size and changed functions of every step executed non-interactively"
+			)
 			("help,h", "Show this help screen.");
 
 		// All positional options should be interpreted as input files
@@ -339,7 +356,7 @@ int main(int argc, char** argv)
 			string sequence = arguments["steps"].as<string>();
 			if (!nonInteractive)
 				cout << "----------------------" << endl;
-			yulOpti.runSteps(input, sequence);
+			yulOpti.runSteps(input, sequence, profile);
 			disambiguated = true;
 		}
 		if (!nonInteractive)